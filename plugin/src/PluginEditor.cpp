@@ -1,5 +1,6 @@
 #include "PluginEditor.h"
 #include "dsp/Scales.h"
+#include "dsp/SimdKernels.h"
 #include <cmath>
 
 //==============================================================================
@@ -19,8 +20,12 @@ SpectrumAnalyzer::~SpectrumAnalyzer()
 
 void SpectrumAnalyzer::timerCallback()
 {
-    if (audioProcessor.getSpectrumData(spectrumData))
+    if (audioProcessor.getSpectrumData(linearMagnitudes))
     {
+        // Convert to dB and normalize to 0-1 range (-100dB to 0dB)
+        fshift::simd::gainToNormalizedDb(linearMagnitudes.data(), spectrumData.data(), 100.0f,
+                                         static_cast<int>(SPECTRUM_SIZE));
+
         // Find peak in current frame (data is normalized 0-1, representing -100dB to 0dB)
         float framePeakNorm = 0.0f;
         for (size_t i = 0; i < SPECTRUM_SIZE; ++i)
@@ -60,7 +65,10 @@ void SpectrumAnalyzer::timerCallback()
         {
             smoothedData[i] = smoothedData[i] * smoothingFactor + spectrumData[i] * (1.0f - smoothingFactor);
         }
-        repaint();
+
+        if (spectrogram != nullptr)
+            spectrogram->pushFrame(spectrumData, displayCeilingDb);
+        repaintSpectrumRegion();
     }
     else
     {
@@ -82,19 +90,105 @@ void SpectrumAnalyzer::timerCallback()
         displayCeilingDb = displayCeilingDb * 0.999f + (-10.0f) * 0.001f;
 
         if (needsRepaint)
-            repaint();
+            repaintSpectrumRegion();
     }
 }
 
-void SpectrumAnalyzer::paint(juce::Graphics& g)
+float SpectrumAnalyzer::getSpectrumY(float magnitudeNorm) const
+{
+    const float magnitudeDb = magnitudeNorm * 100.0f - 100.0f;
+    const float normalized = std::clamp((magnitudeDb - floorDb) / (gridCeilingDb - floorDb), 0.0f, 1.0f);
+    return static_cast<float>(getHeight()) * (1.0f - normalized);
+}
+
+void SpectrumAnalyzer::repaintSpectrumRegion()
+{
+    // A new display range moves the grid: redraw everything once
+    const float snappedCeilingDb = std::round(displayCeilingDb);
+    if (snappedCeilingDb != gridCeilingDb)
+    {
+        gridCeilingDb = snappedCeilingDb;
+        repaint();
+        return;
+    }
+
+    // Otherwise only the band between the highest old/new point and the bottom changes
+    const int numBins = std::min(audioProcessor.getCurrentFFTSize() / 2, SPECTRUM_SIZE);
+    float peakNorm = 0.0f;
+    for (int bin = 1; bin < numBins; ++bin)
+        peakNorm = std::max(peakNorm, smoothedData[static_cast<size_t>(bin)]);
+
+    const float topY = std::min(getSpectrumY(peakNorm), lastSpectrumTopY);
+    const int dirtyTop = std::max(0, static_cast<int>(std::floor(topY)) - 2);
+    repaint(0, dirtyTop, getWidth(), getHeight() - dirtyTop);
+}
+
+void SpectrumAnalyzer::updateColumnTable(double sampleRate, int fftSize)
+{
+    const int width = getWidth();
+    if (fftSize == tableFftSize && width == tableWidth && sampleRate == tableSampleRate)
+        return;
+
+    tableFftSize = fftSize;
+    tableWidth = width;
+    tableSampleRate = sampleRate;
+    columnTable.clear();
+
+    const int numBins = std::min(fftSize / 2, SPECTRUM_SIZE);
+    if (numBins <= 0 || sampleRate <= 0.0 || width <= 0)
+        return;
+
+    const float fMin = 20.0f;
+    const float fMax = static_cast<float>(sampleRate / 2.0);
+    const float binWidth = static_cast<float>(sampleRate) / static_cast<float>(fftSize);
+    const float logRange = std::log(fMax / fMin);
+
+    // Consecutive bins landing in the same pixel column share one entry
+    int currentColumn = -1;
+    for (int bin = 1; bin < numBins; ++bin)
+    {
+        float binFreq = static_cast<float>(bin) * binWidth;
+        if (binFreq < fMin)
+            continue;
+
+        float x = std::log(binFreq / fMin) / logRange * static_cast<float>(width);
+        int column = static_cast<int>(x);
+
+        if (column == currentColumn)
+        {
+            auto& entry = columnTable.back();
+            entry.lastBin = bin;
+            entry.x = static_cast<float>(column) + 0.5f;
+        }
+        else
+        {
+            columnTable.push_back({ x, bin, bin });
+            currentColumn = column;
+        }
+    }
+}
+
+void SpectrumAnalyzer::renderBackground(double sampleRate)
 {
     using Colors = FrequencyShifterEditor::Colors;
 
+    const float scale = juce::Component::getApproximateScaleFactorForComponent(this);
+    backgroundCeilingDb = gridCeilingDb;
+    backgroundSampleRate = sampleRate;
+    backgroundScale = scale;
+
+    backgroundImage = juce::Image(juce::Image::ARGB,
+                                  std::max(1, juce::roundToInt(static_cast<float>(getWidth()) * scale)),
+                                  std::max(1, juce::roundToInt(static_cast<float>(getHeight()) * scale)),
+                                  true);
+    juce::Graphics g(backgroundImage);
+    g.addTransform(juce::AffineTransform::scale(scale));
+
     const auto bounds = getLocalBounds().toFloat();
     const float width = bounds.getWidth();
     const float height = bounds.getHeight();
 
-    const float rangeDb = displayCeilingDb - floorDb;
+    const float rangeDb = gridCeilingDb - floorDb;
 
     // Background
     g.setColour(juce::Colour(Colors::strip));
@@ -107,7 +201,7 @@ void SpectrumAnalyzer::paint(juce::Graphics& g)
     if (rangeDb < 50.0f) gridSpacing = 10;
     if (rangeDb < 30.0f) gridSpacing = 5;
 
-    int ceilingRounded = static_cast<int>(std::ceil(displayCeilingDb / gridSpacing) * gridSpacing);
+    int ceilingRounded = static_cast<int>(std::ceil(gridCeilingDb / gridSpacing) * gridSpacing);
 
     for (int db = ceilingRounded; db >= static_cast<int>(floorDb); db -= gridSpacing)
     {
@@ -126,11 +220,6 @@ void SpectrumAnalyzer::paint(juce::Graphics& g)
         }
     }
 
-    // Get frequency info
-    const double sampleRate = audioProcessor.getSampleRate();
-    const int fftSize = audioProcessor.getCurrentFFTSize();
-    const int numBins = fftSize / 2;
-
     // Frequency labels (logarithmic scale)
     g.setColour(juce::Colour(Colors::textMuted));
     g.setFont(juce::FontOptions(9.0f));
@@ -155,62 +244,83 @@ void SpectrumAnalyzer::paint(juce::Graphics& g)
                        juce::Justification::centred, false);
         }
     }
+}
+
+void SpectrumAnalyzer::paint(juce::Graphics& g)
+{
+    using Colors = FrequencyShifterEditor::Colors;
+
+    const auto bounds = getLocalBounds().toFloat();
+    const float width = bounds.getWidth();
+    const float height = bounds.getHeight();
+
+    const double sampleRate = audioProcessor.getSampleRate();
+    const int fftSize = audioProcessor.getCurrentFFTSize();
+
+    // Static layers: grid and labels come from the cached image
+    if (backgroundImage.isNull()
+        || backgroundCeilingDb != gridCeilingDb
+        || backgroundSampleRate != sampleRate
+        || backgroundScale != juce::Component::getApproximateScaleFactorForComponent(this))
+    {
+        renderBackground(sampleRate);
+    }
+    g.drawImage(backgroundImage, bounds);
+
+    // Draw spectrum, one min/max pair per pixel column
+    updateColumnTable(sampleRate, fftSize);
+    lastSpectrumTopY = height;
 
-    // Draw spectrum
-    if (numBins > 0)
+    if (!columnTable.empty())
     {
         juce::Path spectrumPath;
         juce::Path fillPath;
-
-        const float fMin = 20.0f;
-        const float fMax = static_cast<float>(sampleRate / 2.0);
-        const float binWidth = static_cast<float>(sampleRate) / static_cast<float>(fftSize);
+        spectrumPath.preallocateSpace(static_cast<int>(columnTable.size()) * 6);
+        fillPath.preallocateSpace(static_cast<int>(columnTable.size()) * 3 + 6);
 
         bool pathStarted = false;
 
-        for (int bin = 1; bin < std::min(numBins, SPECTRUM_SIZE); ++bin)
+        for (const auto& column : columnTable)
         {
-            float binFreq = static_cast<float>(bin) * binWidth;
-
-            if (binFreq < fMin)
-                continue;
-
-            float x = std::log(binFreq / fMin) / std::log(fMax / fMin) * width;
-
-            float magnitudeNorm = smoothedData[static_cast<size_t>(bin)];
-            float magnitudeDb = magnitudeNorm * 100.0f - 100.0f;
+            float maxNorm = smoothedData[static_cast<size_t>(column.firstBin)];
+            float minNorm = maxNorm;
+            for (int bin = column.firstBin + 1; bin <= column.lastBin; ++bin)
+            {
+                maxNorm = std::max(maxNorm, smoothedData[static_cast<size_t>(bin)]);
+                minNorm = std::min(minNorm, smoothedData[static_cast<size_t>(bin)]);
+            }
 
-            float normalized = (magnitudeDb - floorDb) / rangeDb;
-            normalized = std::max(0.0f, std::min(1.0f, normalized));
-            float y = height * (1.0f - normalized);
+            const float yTop = getSpectrumY(maxNorm);
+            const float yBottom = getSpectrumY(minNorm);
+            lastSpectrumTopY = std::min(lastSpectrumTopY, yTop);
 
             if (!pathStarted)
             {
-                spectrumPath.startNewSubPath(x, y);
-                fillPath.startNewSubPath(x, height);
-                fillPath.lineTo(x, y);
+                spectrumPath.startNewSubPath(column.x, yTop);
+                fillPath.startNewSubPath(column.x, height);
+                fillPath.lineTo(column.x, yTop);
                 pathStarted = true;
             }
             else
             {
-                spectrumPath.lineTo(x, y);
-                fillPath.lineTo(x, y);
+                // Collapsed bins keep their spread as a vertical stroke
+                if (yBottom > yTop + 0.5f)
+                    spectrumPath.lineTo(column.x, yBottom);
+                spectrumPath.lineTo(column.x, yTop);
+                fillPath.lineTo(column.x, yTop);
             }
         }
 
-        if (pathStarted)
-        {
-            fillPath.lineTo(width, height);
-            fillPath.closeSubPath();
+        fillPath.lineTo(width, height);
+        fillPath.closeSubPath();
 
-            // Draw filled area with accent glow
-            g.setColour(juce::Colour(Colors::accentGlow));
-            g.fillPath(fillPath);
+        // Draw filled area with accent glow
+        g.setColour(juce::Colour(Colors::accentGlow));
+        g.fillPath(fillPath);
 
-            // Draw spectrum line with accent color
-            g.setColour(juce::Colour(Colors::accent));
-            g.strokePath(spectrumPath, juce::PathStrokeType(1.5f));
-        }
+        // Draw spectrum line with accent color
+        g.setColour(juce::Colour(Colors::accent));
+        g.strokePath(spectrumPath, juce::PathStrokeType(1.5f));
     }
 
     // Border
@@ -220,9 +330,366 @@ void SpectrumAnalyzer::paint(juce::Graphics& g)
 
 void SpectrumAnalyzer::resized()
 {
-    // Nothing special needed
+    // Size-dependent caches are rebuilt on the next paint
+    backgroundImage = juce::Image();
+    tableWidth = 0;
+}
+
+//==============================================================================
+// SpectrogramView Implementation
+//==============================================================================
+
+SpectrogramView::SpectrogramView(FrequencyShifterProcessor& processor)
+    : audioProcessor(processor)
+{
+    using Colors = FrequencyShifterEditor::Colors;
+
+    const juce::Colour low(Colors::strip);
+    const juce::Colour mid(Colors::accent);
+    const juce::Colour high(Colors::text);
+    for (int i = 0; i < PALETTE_SIZE; ++i)
+    {
+        const float level = static_cast<float>(i) / static_cast<float>(PALETTE_SIZE - 1);
+        palette[static_cast<size_t>(i)] = level < 0.7f
+            ? low.interpolatedWith(mid, level / 0.7f)
+            : mid.interpolatedWith(high, (level - 0.7f) / 0.3f);
+    }
+
+    setOpaque(true);
+}
+
+void SpectrogramView::resized()
+{
+    // Start a fresh history at the new size
+    ringImage = juce::Image(juce::Image::RGB, std::max(1, getWidth()), std::max(1, getHeight()), false);
+    ringImage.clear(ringImage.getBounds(), palette[0]);
+    writeColumn = 0;
+    tableHeight = 0;
+}
+
+void SpectrogramView::updateRowTable(double sampleRate, int fftSize)
+{
+    const int height = ringImage.getHeight();
+    if (fftSize == tableFftSize && height == tableHeight && sampleRate == tableSampleRate)
+        return;
+
+    tableFftSize = fftSize;
+    tableHeight = height;
+    tableSampleRate = sampleRate;
+    rowTable.clear();
+
+    const int numBins = std::min(fftSize / 2, SPECTRUM_SIZE);
+    if (numBins <= 1 || sampleRate <= 0.0 || height <= 0)
+        return;
+
+    const float fMin = 20.0f;
+    const float fMax = static_cast<float>(sampleRate / 2.0);
+    const float binWidth = static_cast<float>(sampleRate) / static_cast<float>(fftSize);
+
+    // Row y spans [fLo, fHi) on the log axis; sparse low rows take their nearest bin
+    rowTable.resize(static_cast<size_t>(height));
+    for (int y = 0; y < height; ++y)
+    {
+        const float posHi = static_cast<float>(height - y) / static_cast<float>(height);
+        const float posLo = static_cast<float>(height - y - 1) / static_cast<float>(height);
+        const float fHi = fMin * std::pow(fMax / fMin, posHi);
+        const float fLo = fMin * std::pow(fMax / fMin, posLo);
+
+        const int firstBin = std::clamp(static_cast<int>(fLo / binWidth + 0.5f), 1, numBins - 1);
+        const int lastBin = std::clamp(static_cast<int>(fHi / binWidth - 0.5f), firstBin, numBins - 1);
+        rowTable[static_cast<size_t>(y)] = { firstBin, lastBin };
+    }
+}
+
+void SpectrogramView::pushFrame(const std::array<float, SPECTRUM_SIZE>& frame, float ceilingDb)
+{
+    if (ringImage.isNull())
+        return;
+
+    updateRowTable(audioProcessor.getSampleRate(), audioProcessor.getCurrentFFTSize());
+    if (rowTable.empty())
+        return;
+
+    // Same -100dB floor and adaptive ceiling as the line analyzer
+    const float floorDb = -100.0f;
+    const float rangeDb = std::max(1.0f, ceilingDb - floorDb);
+
+    {
+        juce::Image::BitmapData pixels(ringImage, writeColumn, 0, 1, ringImage.getHeight(),
+                                       juce::Image::BitmapData::writeOnly);
+        for (size_t y = 0; y < rowTable.size(); ++y)
+        {
+            const auto& row = rowTable[y];
+            float peakNorm = frame[static_cast<size_t>(row.firstBin)];
+            for (int bin = row.firstBin + 1; bin <= row.lastBin; ++bin)
+                peakNorm = std::max(peakNorm, frame[static_cast<size_t>(bin)]);
+
+            const float level = std::clamp((peakNorm * 100.0f - 100.0f - floorDb) / rangeDb, 0.0f, 1.0f);
+            pixels.setPixelColour(0, static_cast<int>(y),
+                                  palette[static_cast<size_t>(level * static_cast<float>(PALETTE_SIZE - 1))]);
+        }
+    }
+
+    writeColumn = (writeColumn + 1) % ringImage.getWidth();
+    repaint();
+}
+
+void SpectrogramView::paint(juce::Graphics& g)
+{
+    using Colors = FrequencyShifterEditor::Colors;
+
+    if (ringImage.isValid())
+    {
+        // Oldest columns [writeColumn, width) on the left, newest [0, writeColumn) on the right
+        const int width = ringImage.getWidth();
+        const int height = ringImage.getHeight();
+        const int olderWidth = width - writeColumn;
+
+        g.drawImage(ringImage, 0, 0, olderWidth, height, writeColumn, 0, olderWidth, height);
+        if (writeColumn > 0)
+            g.drawImage(ringImage, olderWidth, 0, writeColumn, height, 0, 0, writeColumn, height);
+    }
+
+    // Border
+    g.setColour(juce::Colour(Colors::stripBorder));
+    g.drawRoundedRectangle(getLocalBounds().toFloat().reduced(0.5f), 6.0f, 1.0f);
+}
+
+//==============================================================================
+// NoteActivityMeter Implementation
+//==============================================================================
+
+NoteActivityMeter::NoteActivityMeter(FrequencyShifterProcessor& processor)
+    : audioProcessor(processor)
+{
+    startTimerHz(30);
+}
+
+NoteActivityMeter::~NoteActivityMeter()
+{
+    stopTimer();
+}
+
+void NoteActivityMeter::timerCallback()
+{
+    bool needsRepaint = false;
+
+    const int rootNote = audioProcessor.getRootNote();
+    const int scaleTypeIndex = audioProcessor.getScaleTypeIndex();
+    if (rootNote != cachedRootNote || scaleTypeIndex != cachedScaleType)
+    {
+        cachedRootNote = rootNote;
+        cachedScaleType = scaleTypeIndex;
+        inScale.fill(false);
+        for (int degree : fshift::getScaleDegrees(static_cast<fshift::ScaleType>(scaleTypeIndex)))
+            inScale[static_cast<size_t>(((rootNote + degree) % 12 + 12) % 12)] = true;
+        needsRepaint = true;
+    }
+
+    const bool hasFrame = audioProcessor.getNoteActivity(noteMagnitudes);
+
+    for (size_t note = 0; note < displayLevels.size(); ++note)
+    {
+        // Same -100dB..0dB mapping as the analyzer, fast attack / slow release
+        float target = 0.0f;
+        if (hasFrame)
+        {
+            float db = juce::Decibels::gainToDecibels(noteMagnitudes[note], -100.0f);
+            target = std::clamp((db + 100.0f) / 100.0f, 0.0f, 1.0f);
+        }
+
+        float level = std::max(target, displayLevels[note] * decayRate);
+        if (level < 0.001f)
+            level = 0.0f;
+        if (level != displayLevels[note])
+        {
+            displayLevels[note] = level;
+            needsRepaint = true;
+        }
+    }
+
+    if (needsRepaint)
+        repaint();
+}
+
+void NoteActivityMeter::paint(juce::Graphics& g)
+{
+    using Colors = FrequencyShifterEditor::Colors;
+
+    const auto bounds = getLocalBounds().toFloat();
+    g.setColour(juce::Colour(Colors::strip));
+    g.fillRoundedRectangle(bounds, 3.0f);
+
+    const int numKeys = HIGHEST_NOTE - LOWEST_NOTE + 1;
+    const float keyWidth = bounds.getWidth() / static_cast<float>(numKeys);
+    const float height = bounds.getHeight();
+
+    for (int note = LOWEST_NOTE; note <= HIGHEST_NOTE; ++note)
+    {
+        const int pitchClass = note % 12;
+        const bool isBlackKey = pitchClass == 1 || pitchClass == 3 || pitchClass == 6
+                                || pitchClass == 8 || pitchClass == 10;
+        const float x = static_cast<float>(note - LOWEST_NOTE) * keyWidth;
+        const juce::Rectangle<float> key(x + 0.5f, 1.0f, keyWidth - 1.0f, height - 2.0f);
+
+        // Key body: white keys lighter than black keys
+        g.setColour(juce::Colour(isBlackKey ? Colors::background : Colors::raised));
+        g.fillRect(key);
+
+        // Activity fill (bottom-up)
+        const float level = displayLevels[static_cast<size_t>(note)];
+        if (level > 0.0f)
+        {
+            g.setColour(juce::Colour(Colors::accent).withAlpha(0.35f + 0.65f * level));
+            g.fillRect(key.withTop(key.getBottom() - key.getHeight() * level));
+        }
+
+        // Scale tones get a marker along the bottom edge
+        if (inScale[static_cast<size_t>(pitchClass)])
+        {
+            g.setColour(juce::Colour(pitchClass == ((cachedRootNote % 12) + 12) % 12 ? Colors::text : Colors::accentDim));
+            g.fillRect(key.withTop(key.getBottom() - 2.0f));
+        }
+    }
+
+    g.setColour(juce::Colour(Colors::stripBorder));
+    g.drawRoundedRectangle(bounds.reduced(0.5f), 3.0f, 1.0f);
 }
 
+//==============================================================================
+// DeadlineMeter Implementation
+//==============================================================================
+
+DeadlineMeter::DeadlineMeter(FrequencyShifterProcessor& processor)
+    : audioProcessor(processor)
+{
+    startTimerHz(2);
+}
+
+DeadlineMeter::~DeadlineMeter()
+{
+    stopTimer();
+}
+
+void DeadlineMeter::timerCallback()
+{
+    report = audioProcessor.getBlockTimingMonitor().getReport();
+    repaint();
+}
+
+void DeadlineMeter::paint(juce::Graphics& g)
+{
+    const bool missed = report.missedDeadlines > 0;
+    g.setColour(juce::Colour(missed ? FrequencyShifterEditor::Colors::accent
+                                    : FrequencyShifterEditor::Colors::textMuted));
+    g.setFont(juce::FontOptions(8.0f));
+
+    juce::String text = "XRUN " + juce::String(static_cast<juce::int64>(report.missedDeadlines));
+    if (report.numWorstBlocks > 0)
+    {
+        const auto& worst = report.worstBlocks[0];
+        text += "  PEAK " + juce::String(juce::roundToInt(worst.getLoad() * 100.0f)) + "% "
+              + juce::String(fshift::BlockTimingMonitor::describeFlags(worst.flags));
+    }
+
+    g.drawText(text, getLocalBounds(), juce::Justification::centredRight, true);
+}
+
+void DeadlineMeter::mouseDown(const juce::MouseEvent&)
+{
+    audioProcessor.getBlockTimingMonitor().requestReset();
+}
+
+#if FSHIFT_PROFILING
+//==============================================================================
+// ProfilerOverlay Implementation
+//==============================================================================
+
+ProfilerOverlay::ProfilerOverlay(FrequencyShifterProcessor& processor)
+    : audioProcessor(processor)
+{
+    previousSnapshot = audioProcessor.getStageProfiler().getSnapshot();
+    startTimerHz(4);
+}
+
+ProfilerOverlay::~ProfilerOverlay()
+{
+    stopTimer();
+}
+
+void ProfilerOverlay::timerCallback()
+{
+    auto snapshot = audioProcessor.getStageProfiler().getSnapshot();
+
+    // Per-interval deltas of the monotonic counters
+    std::uint64_t totalNanos = 0;
+    for (size_t i = 0; i < averageMicros.size(); ++i)
+        totalNanos += snapshot.nanos[i] - previousSnapshot.nanos[i];
+
+    for (size_t i = 0; i < averageMicros.size(); ++i)
+    {
+        const auto nanos = snapshot.nanos[i] - previousSnapshot.nanos[i];
+        const auto calls = snapshot.calls[i] - previousSnapshot.calls[i];
+        averageMicros[i] = calls > 0 ? static_cast<float>(nanos) / static_cast<float>(calls) * 0.001f : 0.0f;
+        sharePercent[i] = totalNanos > 0 ? 100.0f * static_cast<float>(nanos) / static_cast<float>(totalNanos) : 0.0f;
+    }
+
+    previousSnapshot = snapshot;
+    repaint();
+}
+
+void ProfilerOverlay::paint(juce::Graphics& g)
+{
+    g.setColour(juce::Colour(0xD0000000));
+    g.fillRoundedRectangle(getLocalBounds().toFloat(), 4.0f);
+
+    g.setFont(juce::FontOptions(10.0f));
+    const int lineHeight = 12;
+    int y = 4;
+
+    g.setColour(juce::Colour(FrequencyShifterEditor::Colors::accent));
+    g.drawText("stage          avg us    %", 6, y, getWidth() - 12, lineHeight, juce::Justification::centredLeft);
+    y += lineHeight;
+
+    g.setColour(juce::Colour(FrequencyShifterEditor::Colors::text));
+    for (int i = 0; i < fshift::StageProfiler::NUM_STAGES; ++i)
+    {
+        const auto index = static_cast<size_t>(i);
+        g.drawText(fshift::StageProfiler::getStageName(static_cast<fshift::ProfileStage>(i)),
+                   6, y, 90, lineHeight, juce::Justification::centredLeft);
+        g.drawText(juce::String(averageMicros[index], 1), 96, y, 40, lineHeight, juce::Justification::centredRight);
+        g.drawText(juce::String(sharePercent[index], 1), 136, y, 34, lineHeight, juce::Justification::centredRight);
+        y += lineHeight;
+    }
+}
+
+void ProfilerOverlay::mouseDown(const juce::MouseEvent&)
+{
+    // Stage timings followed by the instance's memory footprint and setup timings
+    juce::String text(audioProcessor.getStageProfiler().toCsv());
+    const auto memory = audioProcessor.getMemoryReport();
+    text += "\nsubsystem,bytes\n";
+    for (int i = 0; i < FrequencyShifterProcessor::NUM_MEMORY_SUBSYSTEMS; ++i)
+    {
+        text += FrequencyShifterProcessor::getMemorySubsystemName(i);
+        text += "," + juce::String(static_cast<juce::int64>(memory.bytes[static_cast<size_t>(i)])) + "\n";
+    }
+    text += "Total," + juce::String(static_cast<juce::int64>(memory.getTotalBytes())) + "\n";
+
+    // Last setup/restore durations (instantiation and session-load benchmark)
+    const auto setup = audioProcessor.getSetupTimings();
+    text += "\nsetup,us\n";
+    for (int i = 0; i < FrequencyShifterProcessor::NUM_SETUP_STAGES; ++i)
+    {
+        text += FrequencyShifterProcessor::getSetupStageName(i);
+        text += "," + juce::String(setup.lastMicros[static_cast<size_t>(i)], 1) + "\n";
+    }
+    text += "Reinits," + juce::String(setup.numReinits) + "\n";
+    text += "\nsimd," + juce::String(fshift::simd::getInstructionSetName(fshift::simd::getActiveInstructionSet())) + "\n";
+    juce::SystemClipboard::copyTextToClipboard(text);
+}
+#endif
+
 //==============================================================================
 // HolyShifterLookAndFeel Implementation
 //==============================================================================
@@ -500,7 +967,7 @@ void FrequencyShifterEditor::HolyShifterLookAndFeel::drawPopupMenuItem(
 //==============================================================================
 
 FrequencyShifterEditor::FrequencyShifterEditor(FrequencyShifterProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), deadlineMeter(p)
 {
     setLookAndFeel(&holyLookAndFeel);
 
@@ -634,6 +1101,25 @@ FrequencyShifterEditor::FrequencyShifterEditor(FrequencyShifterProcessor& p)
     setupLabel(smearLabel, "Smear");
     addAndMakeVisible(smearLabel);
 
+    // Low latency toggle
+    lowLatencyButton.setButtonText("Low Lat");
+    addAndMakeVisible(lowLatencyButton);
+    lowLatencyAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        audioProcessor.getValueTreeState(), FrequencyShifterProcessor::PARAM_LOW_LATENCY, lowLatencyButton);
+
+    bandSplitButton.setButtonText("Split");
+    addAndMakeVisible(bandSplitButton);
+    bandSplitAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        audioProcessor.getValueTreeState(), FrequencyShifterProcessor::PARAM_BAND_SPLIT, bandSplitButton);
+
+    // Overlap selector
+    overlapCombo.addItem("Eco", 1);
+    overlapCombo.addItem("Std", 2);
+    overlapCombo.addItem("HQ", 3);
+    addAndMakeVisible(overlapCombo);
+    overlapAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.getValueTreeState(), FrequencyShifterProcessor::PARAM_OVERLAP, overlapCombo);
+
     // === LFO Modulation Controls ===
 
     setupHorizontalSlider(lfoDepthSlider);
@@ -775,6 +1261,11 @@ FrequencyShifterEditor::FrequencyShifterEditor(FrequencyShifterProcessor& p)
     };
     addAndMakeVisible(stereoDecorrelateToggle);
 
+    stereoLinkButton.setButtonText("L/R Link");
+    addAndMakeVisible(stereoLinkButton);
+    stereoLinkAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        audioProcessor.getValueTreeState(), FrequencyShifterProcessor::PARAM_STEREO_LINK, stereoLinkButton);
+
     // === Delay Time LFO Controls ===
 
     setupHorizontalSlider(dlyLfoDepthSlider);
@@ -884,19 +1375,37 @@ FrequencyShifterEditor::FrequencyShifterEditor(FrequencyShifterProcessor& p)
         spectrumVisible = spectrumButton.getToggleState();
         if (spectrumVisible && !spectrumAnalyzer)
         {
+            spectrogramView = std::make_unique<SpectrogramView>(audioProcessor);
+            addAndMakeVisible(*spectrogramView);
+
             spectrumAnalyzer = std::make_unique<SpectrumAnalyzer>(audioProcessor);
+            spectrumAnalyzer->setSpectrogram(spectrogramView.get());
             addAndMakeVisible(*spectrumAnalyzer);
+
+            noteActivityMeter = std::make_unique<NoteActivityMeter>(audioProcessor);
+            addAndMakeVisible(*noteActivityMeter);
         }
         if (spectrumAnalyzer)
             spectrumAnalyzer->setVisible(spectrumVisible);
+        if (spectrogramView)
+            spectrogramView->setVisible(spectrumVisible);
+        if (noteActivityMeter)
+            noteActivityMeter->setVisible(spectrumVisible);
 
         if (spectrumVisible)
-            setSize(600, 950);
+            setSize(600, 980);
         else
             setSize(600, 800);
     };
     addAndMakeVisible(spectrumButton);
 
+#if FSHIFT_PROFILING
+    profilerOverlay = std::make_unique<ProfilerOverlay>(audioProcessor);
+    addAndMakeVisible(*profilerOverlay);
+#endif
+
+    addAndMakeVisible(deadlineMeter);
+
     // Set editor size (600px width as per mockup)
     setSize(600, 800);
 
@@ -1069,6 +1578,7 @@ void FrequencyShifterEditor::resized()
     // Title bar controls
     processingModeCombo.setBounds(208, 78, 96, 22);
     warmButton.setBounds(getWidth() - margin - 80, 36, 80, 22);
+    deadlineMeter.setBounds(getWidth() - margin - 210, 40, 124, 14);
 
     // Main shift knob (left side)
     shiftSlider.setBounds(24, 70, 180, 180);
@@ -1103,7 +1613,10 @@ void FrequencyShifterEditor::resized()
     // Smear & Enhance strip
     phaseVocoderButton.setBounds(margin, stripY + stripPadding, 90, 22);
     smearLabel.setBounds(margin + 100, stripY + stripPadding, 38, 20);
-    smearSlider.setBounds(margin + 145, stripY + stripPadding, getWidth() - margin * 2 - 155, 20);
+    smearSlider.setBounds(margin + 145, stripY + stripPadding, getWidth() - margin * 2 - 385, 20);
+    bandSplitButton.setBounds(getWidth() - margin - 220, stripY + stripPadding, 62, 22);
+    overlapCombo.setBounds(getWidth() - margin - 150, stripY + stripPadding, 62, 22);
+    lowLatencyButton.setBounds(getWidth() - margin - 80, stripY + stripPadding, 80, 22);
     stripY += 50;
 
     // Freq Modulation strip
@@ -1142,6 +1655,7 @@ void FrequencyShifterEditor::resized()
 
     delY += 26;
     stereoDecorrelateToggle.setBounds(getWidth() - margin - 100, delY, 100, 20);
+    stereoLinkButton.setBounds(getWidth() - margin - 200, delY, 90, 20);
     stripY += 130;
 
     // Delay Modulation strip
@@ -1181,8 +1695,23 @@ void FrequencyShifterEditor::resized()
     // Spectrum analyzer (when visible)
     if (spectrumAnalyzer && spectrumVisible)
     {
-        spectrumAnalyzer->setBounds(margin, stripY + 10, getWidth() - margin * 2, 130);
+        // Line analyzer on the left, waterfall on the right
+        const int analyzerWidth = (getWidth() - margin * 2 - 8) * 3 / 5;
+        spectrumAnalyzer->setBounds(margin, stripY + 10, analyzerWidth, 130);
+        if (spectrogramView)
+            spectrogramView->setBounds(margin + analyzerWidth + 8, stripY + 10,
+                                       getWidth() - margin * 2 - analyzerWidth - 8, 130);
+
+        // Quantizer note activity below both views
+        if (noteActivityMeter)
+            noteActivityMeter->setBounds(margin, stripY + 148, getWidth() - margin * 2, 22);
     }
+
+#if FSHIFT_PROFILING
+    // Debug readout pinned to the bottom-right corner, above everything else
+    const int overlayHeight = 8 + 12 * (fshift::StageProfiler::NUM_STAGES + 1);
+    profilerOverlay->setBounds(getWidth() - 180, getHeight() - overlayHeight - 4, 176, overlayHeight);
+#endif
 }
 
 void FrequencyShifterEditor::sliderValueChanged(juce::Slider* slider)
@@ -1281,6 +1810,22 @@ void FrequencyShifterEditor::updateControlsForMode()
     phaseVocoderButton.setEnabled(!isClassic);
     phaseVocoderButton.setAlpha(isClassic ? disabledAlpha : enabledAlpha);
 
+    // Low Latency - Spectral only (Classic is already near-zero latency)
+    lowLatencyButton.setEnabled(!isClassic);
+    lowLatencyButton.setAlpha(isClassic ? disabledAlpha : enabledAlpha);
+
+    // Band Split - Spectral only
+    bandSplitButton.setEnabled(!isClassic);
+    bandSplitButton.setAlpha(isClassic ? disabledAlpha : enabledAlpha);
+
+    // Overlap - Spectral only
+    overlapCombo.setEnabled(!isClassic);
+    overlapCombo.setAlpha(isClassic ? disabledAlpha : enabledAlpha);
+
+    // Stereo Link (phase vocoder peaks) - Spectral only
+    stereoLinkButton.setEnabled(!isClassic);
+    stereoLinkButton.setAlpha(isClassic ? disabledAlpha : enabledAlpha);
+
     // Mask controls - all Spectral only
     maskEnabledButton.setEnabled(!isClassic);
     maskEnabledButton.setAlpha(isClassic ? disabledAlpha : enabledAlpha);
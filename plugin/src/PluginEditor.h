@@ -3,6 +3,8 @@
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
 
+class SpectrogramView;
+
 /**
  * SpectrumAnalyzer - Real-time spectrum visualization component.
  *
@@ -19,12 +21,48 @@ public:
     void paint(juce::Graphics& g) override;
     void resized() override;
 
+    // Forward each new frame to a waterfall view (nullptr to detach)
+    void setSpectrogram(SpectrogramView* view) { spectrogram = view; }
+
 private:
     void timerCallback() override;
 
+    void updateColumnTable(double sampleRate, int fftSize);
+    void renderBackground(double sampleRate);
+    void repaintSpectrumRegion();
+    float getSpectrumY(float magnitudeNorm) const;
+
     FrequencyShifterProcessor& audioProcessor;
+    SpectrogramView* spectrogram = nullptr;
+
+    // Bin range collapsed into each pixel column (rebuilt on FFT size, rate or width change)
+    struct ColumnBins
+    {
+        float x;
+        int firstBin;
+        int lastBin;
+    };
+    std::vector<ColumnBins> columnTable;
+    int tableFftSize = 0;
+    int tableWidth = 0;
+    double tableSampleRate = 0.0;
 
-    // Spectrum data buffer
+    // Cached grid and labels (rebuilt on resize or range change)
+    juce::Image backgroundImage;
+    float backgroundCeilingDb = 0.0f;
+    double backgroundSampleRate = 0.0;
+    float backgroundScale = 0.0f;
+
+    // Display ceiling snapped to whole dB so slow drift doesn't invalidate the cache
+    float gridCeilingDb = -10.0f;
+
+    // Highest spectrum point drawn by the last paint (for dirty-region repaints)
+    float lastSpectrumTopY = 0.0f;
+
+    // Latest linear magnitudes from the processor
+    std::array<float, SPECTRUM_SIZE> linearMagnitudes{};
+
+    // Spectrum data buffer (normalized 0-1, representing -100dB to 0dB)
     std::array<float, SPECTRUM_SIZE> spectrumData{};
 
     // Smoothed display data
@@ -44,6 +82,146 @@ private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumAnalyzer)
 };
 
+/**
+ * SpectrogramView - Scrolling waterfall of the processed spectrum.
+ *
+ * Frames are pushed by SpectrumAnalyzer (no extra polling). Each frame is
+ * rendered as one pixel column into a ring-buffer image; paint() blits the
+ * ring in two pieces so the newest column sits at the right edge. Frequency
+ * runs bottom-to-top on the analyzer's log scale.
+ */
+class SpectrogramView : public juce::Component
+{
+public:
+    SpectrogramView(FrequencyShifterProcessor& processor);
+
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+
+    // Render one frame (normalized 0-1, -100dB to 0dB) relative to the display ceiling
+    void pushFrame(const std::array<float, SPECTRUM_SIZE>& frame, float ceilingDb);
+
+private:
+    void updateRowTable(double sampleRate, int fftSize);
+
+    FrequencyShifterProcessor& audioProcessor;
+
+    // Ring-buffer image, writeColumn is the next column to fill
+    juce::Image ringImage;
+    int writeColumn = 0;
+
+    // Bin range for each pixel row, top row first (rebuilt on FFT size, rate or height change)
+    struct RowBins
+    {
+        int firstBin;
+        int lastBin;
+    };
+    std::vector<RowBins> rowTable;
+    int tableFftSize = 0;
+    int tableHeight = 0;
+    double tableSampleRate = 0.0;
+
+    // Level-to-colour lookup (dark strip -> accent -> text)
+    static constexpr int PALETTE_SIZE = 256;
+    std::array<juce::Colour, PALETTE_SIZE> palette;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrogramView)
+};
+
+/**
+ * NoteActivityMeter - Keyboard strip showing which notes the quantizer is feeding.
+ *
+ * Reads the per-note energy the quantizer publishes each frame (no extra
+ * analysis), smooths it and draws one key per MIDI note over the piano range.
+ * Keys in the current scale are outlined so active scale tones stand out.
+ */
+class NoteActivityMeter : public juce::Component,
+                           private juce::Timer
+{
+public:
+    NoteActivityMeter(FrequencyShifterProcessor& processor);
+    ~NoteActivityMeter() override;
+
+    void paint(juce::Graphics& g) override;
+
+private:
+    void timerCallback() override;
+
+    FrequencyShifterProcessor& audioProcessor;
+
+    static constexpr int NUM_NOTES = fshift::MusicalQuantizer::NUM_MIDI_NOTES;
+    static constexpr int LOWEST_NOTE = 21;   // A0
+    static constexpr int HIGHEST_NOTE = 108; // C8
+
+    std::array<float, NUM_NOTES> noteMagnitudes{};
+    std::array<float, NUM_NOTES> displayLevels{};  // 0-1, smoothed
+
+    // Scale membership per pitch class (refreshed when root/scale change)
+    std::array<bool, 12> inScale{};
+    int cachedRootNote = -1;
+    int cachedScaleType = -1;
+
+    static constexpr float decayRate = 0.85f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(NoteActivityMeter)
+};
+
+/**
+ * DeadlineMeter - Compact readout of processBlock deadline statistics.
+ *
+ * Shows the number of blocks that overran their deadline and the worst
+ * block's load with the code paths it ran. Clicking resets the statistics.
+ */
+class DeadlineMeter : public juce::Component,
+                       private juce::Timer
+{
+public:
+    DeadlineMeter(FrequencyShifterProcessor& processor);
+    ~DeadlineMeter() override;
+
+    void paint(juce::Graphics& g) override;
+    void mouseDown(const juce::MouseEvent& event) override;
+
+private:
+    void timerCallback() override;
+
+    FrequencyShifterProcessor& audioProcessor;
+    fshift::BlockTimingMonitor::Report report;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DeadlineMeter)
+};
+
+#if FSHIFT_PROFILING
+/**
+ * ProfilerOverlay - Debug readout of per-stage CPU time.
+ *
+ * Shows the average microseconds per call and share of measured time for
+ * each processing stage over the last refresh interval. Clicking copies the
+ * cumulative counters to the clipboard as CSV.
+ */
+class ProfilerOverlay : public juce::Component,
+                         private juce::Timer
+{
+public:
+    ProfilerOverlay(FrequencyShifterProcessor& processor);
+    ~ProfilerOverlay() override;
+
+    void paint(juce::Graphics& g) override;
+    void mouseDown(const juce::MouseEvent& event) override;
+
+private:
+    void timerCallback() override;
+
+    FrequencyShifterProcessor& audioProcessor;
+
+    fshift::StageProfiler::Snapshot previousSnapshot;
+    std::array<float, fshift::StageProfiler::NUM_STAGES> averageMicros{};
+    std::array<float, fshift::StageProfiler::NUM_STAGES> sharePercent{};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ProfilerOverlay)
+};
+#endif
+
 /**
  * FrequencyShifterEditor - GUI for the Frequency Shifter plugin.
  *
@@ -159,6 +337,18 @@ private:
     juce::Label smearLabel;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> smearAttachment;
 
+    // Low latency toggle (report active FFT size latency)
+    juce::ToggleButton lowLatencyButton;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> lowLatencyAttachment;
+
+    // Band split toggle (decimated long-FFT low band, SMEAR-sized high band)
+    juce::ToggleButton bandSplitButton;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> bandSplitAttachment;
+
+    // STFT overlap selector (Eco / Std / HQ)
+    juce::ComboBox overlapCombo;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> overlapAttachment;
+
     // LFO Modulation controls
     juce::Slider lfoDepthSlider;
     juce::Label lfoDepthLabel;
@@ -207,8 +397,11 @@ private:
     // Manual sync (SliderAttachment doesn't support custom ranges for log scale)
     void sliderValueChanged(juce::Slider* slider) override;
 
-    // Spectrum analyzer
+    // Spectrum analyzer and waterfall (waterfall declared first so the analyzer,
+    // which feeds it, is destroyed first)
+    std::unique_ptr<SpectrogramView> spectrogramView;
     std::unique_ptr<SpectrumAnalyzer> spectrumAnalyzer;
+    std::unique_ptr<NoteActivityMeter> noteActivityMeter;
     juce::ToggleButton spectrumButton;
     bool spectrumVisible = false;
 
@@ -267,6 +460,18 @@ private:
     // Stereo decorrelation toggle (testing feature)
     juce::ToggleButton stereoDecorrelateToggle;
 
+    // Stereo-linked phase vocoder peaks
+    juce::ToggleButton stereoLinkButton;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> stereoLinkAttachment;
+
+    // processBlock deadline statistics
+    DeadlineMeter deadlineMeter;
+
+#if FSHIFT_PROFILING
+    // Per-stage CPU readout (profiling builds only)
+    std::unique_ptr<ProfilerOverlay> profilerOverlay;
+#endif
+
 public:
     // UI colors - Holy Shifter color scheme (public for SpectrumAnalyzer access)
     struct Colors
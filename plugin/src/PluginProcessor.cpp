@@ -8,88 +8,22 @@ FrequencyShifterProcessor::FrequencyShifterProcessor()
                          .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
       parameters(*this, nullptr, juce::Identifier("FrequencyShifter"), createParameterLayout())
 {
-    // Add parameter listeners
-    parameters.addParameterListener(PARAM_SHIFT_HZ, this);
-    parameters.addParameterListener(PARAM_QUANTIZE_STRENGTH, this);
-    parameters.addParameterListener(PARAM_ROOT_NOTE, this);
-    parameters.addParameterListener(PARAM_SCALE_TYPE, this);
-    parameters.addParameterListener(PARAM_DRY_WET, this);
-    parameters.addParameterListener(PARAM_PHASE_VOCODER, this);
-    parameters.addParameterListener(PARAM_SMEAR, this);
-    parameters.addParameterListener(PARAM_LFO_DEPTH, this);
-    parameters.addParameterListener(PARAM_LFO_DEPTH_MODE, this);
-    parameters.addParameterListener(PARAM_LFO_RATE, this);
-    parameters.addParameterListener(PARAM_LFO_SYNC, this);
-    parameters.addParameterListener(PARAM_LFO_DIVISION, this);
-    parameters.addParameterListener(PARAM_LFO_SHAPE, this);
-    parameters.addParameterListener(PARAM_DLY_LFO_DEPTH, this);
-    parameters.addParameterListener(PARAM_DLY_LFO_RATE, this);
-    parameters.addParameterListener(PARAM_DLY_LFO_SYNC, this);
-    parameters.addParameterListener(PARAM_DLY_LFO_DIVISION, this);
-    parameters.addParameterListener(PARAM_DLY_LFO_SHAPE, this);
-    parameters.addParameterListener(PARAM_MASK_ENABLED, this);
-    parameters.addParameterListener(PARAM_MASK_MODE, this);
-    parameters.addParameterListener(PARAM_MASK_LOW_FREQ, this);
-    parameters.addParameterListener(PARAM_MASK_HIGH_FREQ, this);
-    parameters.addParameterListener(PARAM_MASK_TRANSITION, this);
-    parameters.addParameterListener(PARAM_DELAY_ENABLED, this);
-    parameters.addParameterListener(PARAM_DELAY_TIME, this);
-    parameters.addParameterListener(PARAM_DELAY_SYNC, this);
-    parameters.addParameterListener(PARAM_DELAY_DIVISION, this);
-    parameters.addParameterListener(PARAM_DELAY_SLOPE, this);
-    parameters.addParameterListener(PARAM_DELAY_FEEDBACK, this);
-    parameters.addParameterListener(PARAM_DELAY_DAMPING, this);
-    parameters.addParameterListener(PARAM_DELAY_DIFFUSE, this);
-    parameters.addParameterListener(PARAM_DELAY_GAIN, this);
-    parameters.addParameterListener(PARAM_PRESERVE, this);
-    parameters.addParameterListener(PARAM_TRANSIENTS, this);
-    parameters.addParameterListener(PARAM_SENSITIVITY, this);
-    parameters.addParameterListener(PARAM_PROCESSING_MODE, this);
-    parameters.addParameterListener(PARAM_WARM, this);
+    // Cache raw value pointers for the per-block parameter poll
+    for (int i = 0; i < NUM_PARAMETERS; ++i)
+    {
+        rawParameterValues[static_cast<size_t>(i)] = parameters.getRawParameterValue(PARAMETER_IDS[i]);
+        jassert(rawParameterValues[static_cast<size_t>(i)] != nullptr);
+    }
 
     // Initialize quantizer with default scale (C Major)
     quantizer = std::make_unique<fshift::MusicalQuantizer>(60, fshift::ScaleType::Major);
+
+    recordSetupTime(SETUP_CONSTRUCT, constructionStart);
 }
 
 FrequencyShifterProcessor::~FrequencyShifterProcessor()
 {
-    parameters.removeParameterListener(PARAM_SHIFT_HZ, this);
-    parameters.removeParameterListener(PARAM_QUANTIZE_STRENGTH, this);
-    parameters.removeParameterListener(PARAM_ROOT_NOTE, this);
-    parameters.removeParameterListener(PARAM_SCALE_TYPE, this);
-    parameters.removeParameterListener(PARAM_DRY_WET, this);
-    parameters.removeParameterListener(PARAM_PHASE_VOCODER, this);
-    parameters.removeParameterListener(PARAM_SMEAR, this);
-    parameters.removeParameterListener(PARAM_LFO_DEPTH, this);
-    parameters.removeParameterListener(PARAM_LFO_DEPTH_MODE, this);
-    parameters.removeParameterListener(PARAM_LFO_RATE, this);
-    parameters.removeParameterListener(PARAM_LFO_SYNC, this);
-    parameters.removeParameterListener(PARAM_LFO_DIVISION, this);
-    parameters.removeParameterListener(PARAM_LFO_SHAPE, this);
-    parameters.removeParameterListener(PARAM_DLY_LFO_DEPTH, this);
-    parameters.removeParameterListener(PARAM_DLY_LFO_RATE, this);
-    parameters.removeParameterListener(PARAM_DLY_LFO_SYNC, this);
-    parameters.removeParameterListener(PARAM_DLY_LFO_DIVISION, this);
-    parameters.removeParameterListener(PARAM_DLY_LFO_SHAPE, this);
-    parameters.removeParameterListener(PARAM_MASK_ENABLED, this);
-    parameters.removeParameterListener(PARAM_MASK_MODE, this);
-    parameters.removeParameterListener(PARAM_MASK_LOW_FREQ, this);
-    parameters.removeParameterListener(PARAM_MASK_HIGH_FREQ, this);
-    parameters.removeParameterListener(PARAM_MASK_TRANSITION, this);
-    parameters.removeParameterListener(PARAM_DELAY_ENABLED, this);
-    parameters.removeParameterListener(PARAM_DELAY_TIME, this);
-    parameters.removeParameterListener(PARAM_DELAY_SYNC, this);
-    parameters.removeParameterListener(PARAM_DELAY_DIVISION, this);
-    parameters.removeParameterListener(PARAM_DELAY_SLOPE, this);
-    parameters.removeParameterListener(PARAM_DELAY_FEEDBACK, this);
-    parameters.removeParameterListener(PARAM_DELAY_DAMPING, this);
-    parameters.removeParameterListener(PARAM_DELAY_DIFFUSE, this);
-    parameters.removeParameterListener(PARAM_DELAY_GAIN, this);
-    parameters.removeParameterListener(PARAM_PRESERVE, this);
-    parameters.removeParameterListener(PARAM_TRANSIENTS, this);
-    parameters.removeParameterListener(PARAM_SENSITIVITY, this);
-    parameters.removeParameterListener(PARAM_PROCESSING_MODE, this);
-    parameters.removeParameterListener(PARAM_WARM, this);
+    tableBuilderThread.stopThread(1000);
 }
 
 juce::AudioProcessorValueTreeState::ParameterLayout FrequencyShifterProcessor::createParameterLayout()
@@ -451,215 +385,360 @@ juce::AudioProcessorValueTreeState::ParameterLayout FrequencyShifterProcessor::c
         "Warm",
         false));  // Default to off
 
+    // LOW LATENCY: Asymmetric windows, report frame latency instead of fixed MAX_FFT_SIZE
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{ PARAM_LOW_LATENCY, 1 },
+        "Low Latency",
+        false));  // Default to fixed latency (no PDC jumps when SMEAR moves)
+
+    // OVERLAP: STFT overlap factor (Eco halves frame rate, HQ doubles it)
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID{ PARAM_OVERLAP, 1 },
+        "Overlap",
+        juce::StringArray{ "Eco (2x)", "Standard (4x)", "HQ (8x)" },
+        1));  // Default to Standard (75% overlap)
+
+    // STEREO LINK: Shared phase vocoder peak structure for a coherent stereo image
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{ PARAM_STEREO_LINK, 1 },
+        "Stereo Link",
+        false));  // Default to independent channels
+
+    // BAND SPLIT: Long-window decimated low band, SMEAR-sized full-rate high band
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{ PARAM_BAND_SPLIT, 1 },
+        "Band Split",
+        false));  // Default to a single full-band STFT
+
     return { params.begin(), params.end() };
 }
 
-void FrequencyShifterProcessor::parameterChanged(const juce::String& parameterID, float newValue)
+void FrequencyShifterProcessor::pollParameters()
 {
-    if (parameterID == PARAM_SHIFT_HZ)
-    {
-        shiftHz.store(newValue);
-    }
-    else if (parameterID == PARAM_QUANTIZE_STRENGTH)
-    {
-        quantizeStrength.store(newValue / 100.0f);
-    }
-    else if (parameterID == PARAM_ROOT_NOTE)
+    // One relaxed load per parameter; only entries that differ from the last
+    // snapshot are applied (all of them on the first poll)
+    for (int i = 0; i < NUM_PARAMETERS; ++i)
     {
-        // Index is now 0-11 (pitch class), use middle octave (C4=60) as reference
-        int midiNote = static_cast<int>(newValue) + 60;  // C=60, C#=61, ..., B=71
-        rootNote.store(midiNote);
-        if (quantizer)
+        const auto index = static_cast<size_t>(i);
+        const float value = rawParameterValues[index]->load(std::memory_order_relaxed);
+        if (!parameterSnapshotValid || value != parameterSnapshot.values[index])
         {
-            quantizer->setRootNote(midiNote);
+            parameterSnapshot.values[index] = value;
+            applyParameterChange(i, value);
         }
     }
-    else if (parameterID == PARAM_SCALE_TYPE)
+    parameterSnapshotValid = true;
+}
+
+void FrequencyShifterProcessor::applyParameterChange(int index, float newValue)
+{
+    switch (index)
     {
-        int scale = static_cast<int>(newValue);
-        scaleType.store(scale);
-        if (quantizer)
+        case IDX_SHIFT_HZ:
         {
-            quantizer->setScaleType(static_cast<fshift::ScaleType>(scale));
+            shiftHz.store(newValue);
+            break;
         }
-    }
-    else if (parameterID == PARAM_DRY_WET)
-    {
-        dryWetMix.store(newValue / 100.0f);
-    }
-    else if (parameterID == PARAM_PHASE_VOCODER)
-    {
-        usePhaseVocoder.store(newValue > 0.5f);
-    }
-    else if (parameterID == PARAM_SMEAR)
-    {
-        float oldSmear = smearMs.load();
-        if (std::abs(newValue - oldSmear) > 0.1f)
+        case IDX_QUANTIZE_STRENGTH:
         {
-            smearMs.store(newValue);
-            needsReinit.store(true);
+            quantizeStrength.store(newValue / 100.0f);
+            break;
         }
-    }
-    else if (parameterID == PARAM_LFO_DEPTH)
-    {
-        lfoDepth.store(newValue);
-    }
-    else if (parameterID == PARAM_LFO_DEPTH_MODE)
-    {
-        lfoDepthMode.store(static_cast<int>(newValue));
-    }
-    else if (parameterID == PARAM_LFO_RATE)
-    {
-        lfoRate.store(newValue);
-    }
-    else if (parameterID == PARAM_LFO_SYNC)
-    {
-        lfoSync.store(newValue > 0.5f);
-    }
-    else if (parameterID == PARAM_LFO_DIVISION)
-    {
-        lfoDivision.store(static_cast<int>(newValue));
-    }
-    else if (parameterID == PARAM_LFO_SHAPE)
-    {
-        lfoShape.store(static_cast<int>(newValue));
-    }
-    else if (parameterID == PARAM_DLY_LFO_DEPTH)
-    {
-        dlyLfoDepth.store(newValue);
-    }
-    else if (parameterID == PARAM_DLY_LFO_RATE)
-    {
-        dlyLfoRate.store(newValue);
-    }
-    else if (parameterID == PARAM_DLY_LFO_SYNC)
-    {
-        dlyLfoSync.store(newValue > 0.5f);
-    }
-    else if (parameterID == PARAM_DLY_LFO_DIVISION)
-    {
-        dlyLfoDivision.store(static_cast<int>(newValue));
-    }
-    else if (parameterID == PARAM_DLY_LFO_SHAPE)
-    {
-        dlyLfoShape.store(static_cast<int>(newValue));
-    }
-    else if (parameterID == PARAM_MASK_ENABLED)
-    {
-        maskEnabled.store(newValue > 0.5f);
-    }
-    else if (parameterID == PARAM_MASK_MODE)
-    {
-        int mode = static_cast<int>(newValue);
-        maskMode.store(mode);
-        // Defer spectralMask.setMode() to audio thread for thread safety
-        maskNeedsUpdate.store(true);
-    }
-    else if (parameterID == PARAM_MASK_LOW_FREQ)
-    {
-        maskLowFreq.store(newValue);
-        // Defer spectralMask.setLowFreq() to audio thread for thread safety
-        maskNeedsUpdate.store(true);
-    }
-    else if (parameterID == PARAM_MASK_HIGH_FREQ)
-    {
-        maskHighFreq.store(newValue);
-        // Defer spectralMask.setHighFreq() to audio thread for thread safety
-        maskNeedsUpdate.store(true);
-    }
-    else if (parameterID == PARAM_MASK_TRANSITION)
-    {
-        maskTransition.store(newValue);
-        // Defer spectralMask.setTransition() to audio thread for thread safety
-        maskNeedsUpdate.store(true);
-    }
-    else if (parameterID == PARAM_DELAY_ENABLED)
-    {
-        delayEnabled.store(newValue > 0.5f);
-    }
-    else if (parameterID == PARAM_DELAY_TIME)
-    {
-        delayTime.store(newValue);
-        // Defer spectralDelay updates to audio thread for thread safety
-        delayNeedsUpdate.store(true);
-    }
-    else if (parameterID == PARAM_DELAY_SYNC)
-    {
-        delaySync.store(newValue > 0.5f);
-    }
-    else if (parameterID == PARAM_DELAY_DIVISION)
-    {
-        delayDivision.store(static_cast<int>(newValue));
-    }
-    else if (parameterID == PARAM_DELAY_SLOPE)
-    {
-        delaySlope.store(newValue);
-        // Defer spectralDelay updates to audio thread for thread safety
-        delayNeedsUpdate.store(true);
-    }
-    else if (parameterID == PARAM_DELAY_FEEDBACK)
-    {
-        delayFeedback.store(newValue);
-        // Defer spectralDelay updates to audio thread for thread safety
-        delayNeedsUpdate.store(true);
-    }
-    else if (parameterID == PARAM_DELAY_DAMPING)
-    {
-        delayDamping.store(newValue);
-        // Defer spectralDelay updates to audio thread for thread safety
-        delayNeedsUpdate.store(true);
-    }
-    else if (parameterID == PARAM_DELAY_DIFFUSE)
-    {
-        delayDiffuse.store(newValue);
-        // Defer spectralDelay updates to audio thread for thread safety
-        delayNeedsUpdate.store(true);
-    }
-    else if (parameterID == PARAM_DELAY_GAIN)
-    {
-        delayGain.store(newValue);
-        // Defer spectralDelay updates to audio thread for thread safety
-        delayNeedsUpdate.store(true);
-    }
-    else if (parameterID == PARAM_PRESERVE)
-    {
-        preserveAmount.store(newValue / 100.0f);
-        if (quantizer)
-            quantizer->setPreserveAmount(newValue / 100.0f);
-    }
-    else if (parameterID == PARAM_TRANSIENTS)
-    {
-        transientAmount.store(newValue / 100.0f);
-        if (quantizer)
-            quantizer->setTransientAmount(newValue / 100.0f);
-    }
-    else if (parameterID == PARAM_SENSITIVITY)
-    {
-        transientSensitivity.store(newValue / 100.0f);
-        if (quantizer)
-            quantizer->setTransientSensitivity(newValue / 100.0f);
-    }
-    else if (parameterID == PARAM_PROCESSING_MODE)
-    {
-        int newMode = static_cast<int>(newValue);
-        int currentMode = processingMode.load();
-        if (newMode != currentMode)
+        case IDX_ROOT_NOTE:
         {
-            // Initiate crossfade to new mode
-            previousMode = currentMode;
-            targetMode = newMode;
-            modeCrossfadeProgress = 0.0f;
-            needsModeSwitch.store(true);
+            // Index is now 0-11 (pitch class), use middle octave (C4=60) as reference
+            int midiNote = static_cast<int>(newValue) + 60;  // C=60, C#=61, ..., B=71
+            rootNote.store(midiNote);
+            if (quantizer)
+            {
+                quantizer->setRootNote(midiNote);
+            }
+            if (lowBandQuantizer)
+            {
+                lowBandQuantizer->setRootNote(midiNote);
+            }
+            break;
         }
-    }
-    else if (parameterID == PARAM_WARM)
-    {
-        warmEnabled.store(newValue > 0.5f);
+        case IDX_SCALE_TYPE:
+        {
+            int scale = static_cast<int>(newValue);
+            scaleType.store(scale);
+            if (quantizer)
+            {
+                quantizer->setScaleType(static_cast<fshift::ScaleType>(scale));
+            }
+            if (lowBandQuantizer)
+            {
+                lowBandQuantizer->setScaleType(static_cast<fshift::ScaleType>(scale));
+            }
+            break;
+        }
+        case IDX_DRY_WET:
+        {
+            dryWetMix.store(newValue / 100.0f);
+            break;
+        }
+        case IDX_PHASE_VOCODER:
+        {
+            usePhaseVocoder.store(newValue > 0.5f);
+            break;
+        }
+        case IDX_SMEAR:
+        {
+            float oldSmear = smearMs.load();
+            if (std::abs(newValue - oldSmear) > 0.1f)
+            {
+                smearMs.store(newValue);
+                needsReinit.store(true);
+            }
+            break;
+        }
+        case IDX_LFO_DEPTH:
+        {
+            lfoDepth.store(newValue);
+            break;
+        }
+        case IDX_LFO_DEPTH_MODE:
+        {
+            lfoDepthMode.store(static_cast<int>(newValue));
+            break;
+        }
+        case IDX_LFO_RATE:
+        {
+            lfoRate.store(newValue);
+            break;
+        }
+        case IDX_LFO_SYNC:
+        {
+            lfoSync.store(newValue > 0.5f);
+            break;
+        }
+        case IDX_LFO_DIVISION:
+        {
+            lfoDivision.store(static_cast<int>(newValue));
+            break;
+        }
+        case IDX_LFO_SHAPE:
+        {
+            lfoShape.store(static_cast<int>(newValue));
+            break;
+        }
+        case IDX_DLY_LFO_DEPTH:
+        {
+            dlyLfoDepth.store(newValue);
+            break;
+        }
+        case IDX_DLY_LFO_RATE:
+        {
+            dlyLfoRate.store(newValue);
+            break;
+        }
+        case IDX_DLY_LFO_SYNC:
+        {
+            dlyLfoSync.store(newValue > 0.5f);
+            break;
+        }
+        case IDX_DLY_LFO_DIVISION:
+        {
+            dlyLfoDivision.store(static_cast<int>(newValue));
+            break;
+        }
+        case IDX_DLY_LFO_SHAPE:
+        {
+            dlyLfoShape.store(static_cast<int>(newValue));
+            break;
+        }
+        case IDX_MASK_ENABLED:
+        {
+            maskEnabled.store(newValue > 0.5f);
+            break;
+        }
+        case IDX_MASK_MODE:
+        {
+            int mode = static_cast<int>(newValue);
+            maskMode.store(mode);
+            // Mask curve is rebuilt by the table builder thread
+            tablesNeedRebuild.store(true);
+            break;
+        }
+        case IDX_MASK_LOW_FREQ:
+        {
+            maskLowFreq.store(newValue);
+            // Mask curve is rebuilt by the table builder thread
+            tablesNeedRebuild.store(true);
+            break;
+        }
+        case IDX_MASK_HIGH_FREQ:
+        {
+            maskHighFreq.store(newValue);
+            // Mask curve is rebuilt by the table builder thread
+            tablesNeedRebuild.store(true);
+            break;
+        }
+        case IDX_MASK_TRANSITION:
+        {
+            maskTransition.store(newValue);
+            // Mask curve is rebuilt by the table builder thread
+            tablesNeedRebuild.store(true);
+            break;
+        }
+        case IDX_DELAY_ENABLED:
+        {
+            const bool enabled = newValue > 0.5f;
+            delayEnabled.store(enabled);
+            break;
+        }
+        case IDX_DELAY_TIME:
+        {
+            delayTime.store(newValue);
+            // Spectral delays are updated once after the parameter poll
+            delayNeedsUpdate.store(true);
+            break;
+        }
+        case IDX_DELAY_SYNC:
+        {
+            delaySync.store(newValue > 0.5f);
+            break;
+        }
+        case IDX_DELAY_DIVISION:
+        {
+            delayDivision.store(static_cast<int>(newValue));
+            break;
+        }
+        case IDX_DELAY_SLOPE:
+        {
+            delaySlope.store(newValue);
+            // Per-bin delay curve is rebuilt by the table builder thread
+            tablesNeedRebuild.store(true);
+            break;
+        }
+        case IDX_DELAY_FEEDBACK:
+        {
+            delayFeedback.store(newValue);
+            // Spectral delays are updated once after the parameter poll
+            delayNeedsUpdate.store(true);
+            break;
+        }
+        case IDX_DELAY_DAMPING:
+        {
+            delayDamping.store(newValue);
+            // Damping curve is rebuilt by the table builder thread; the
+            // time-domain feedback filter is updated after the parameter poll
+            tablesNeedRebuild.store(true);
+            delayNeedsUpdate.store(true);
+            break;
+        }
+        case IDX_DELAY_DIFFUSE:
+        {
+            delayDiffuse.store(newValue);
+            // Spectral delays are updated once after the parameter poll
+            delayNeedsUpdate.store(true);
+            break;
+        }
+        case IDX_DELAY_GAIN:
+        {
+            delayGain.store(newValue);
+            // Spectral delays are updated once after the parameter poll
+            delayNeedsUpdate.store(true);
+            break;
+        }
+        case IDX_PRESERVE:
+        {
+            preserveAmount.store(newValue / 100.0f);
+            if (quantizer)
+                quantizer->setPreserveAmount(newValue / 100.0f);
+            if (lowBandQuantizer)
+                lowBandQuantizer->setPreserveAmount(newValue / 100.0f);
+            break;
+        }
+        case IDX_TRANSIENTS:
+        {
+            transientAmount.store(newValue / 100.0f);
+            if (quantizer)
+                quantizer->setTransientAmount(newValue / 100.0f);
+            if (lowBandQuantizer)
+                lowBandQuantizer->setTransientAmount(newValue / 100.0f);
+            break;
+        }
+        case IDX_SENSITIVITY:
+        {
+            transientSensitivity.store(newValue / 100.0f);
+            if (quantizer)
+                quantizer->setTransientSensitivity(newValue / 100.0f);
+            if (lowBandQuantizer)
+                lowBandQuantizer->setTransientSensitivity(newValue / 100.0f);
+            break;
+        }
+        case IDX_PROCESSING_MODE:
+        {
+            int newMode = static_cast<int>(newValue);
+            int currentMode = processingMode.load();
+            if (!parameterSnapshotValid)
+            {
+                // Initial state (e.g. restored session): start in the saved mode without a crossfade
+                processingMode.store(newMode);
+                targetMode = newMode;
+            }
+            else if (newMode != currentMode)
+            {
+                // Initiate crossfade to new mode
+                previousMode = currentMode;
+                targetMode = newMode;
+                modeCrossfadeProgress = 0.0f;
+                needsModeSwitch.store(true);
+            }
+            break;
+        }
+        case IDX_WARM:
+        {
+            warmEnabled.store(newValue > 0.5f);
+            break;
+        }
+        case IDX_LOW_LATENCY:
+        {
+            bool enabled = newValue > 0.5f;
+            if (enabled != lowLatencyEnabled.load())
+            {
+                lowLatencyEnabled.store(enabled);
+                // Reinit flushes the overlap-add and dry delay state for the new alignment
+                needsReinit.store(true);
+            }
+            break;
+        }
+        case IDX_STEREO_LINK:
+        {
+            stereoLinkEnabled.store(newValue > 0.5f);
+            break;
+        }
+        case IDX_BAND_SPLIT:
+        {
+            bool enabled = newValue > 0.5f;
+            if (enabled != bandSplitEnabled.load())
+            {
+                bandSplitEnabled.store(enabled);
+                // Processor 1 is rebuilt as the low band (or back to the SMEAR size)
+                needsReinit.store(true);
+            }
+            break;
+        }
+        case IDX_OVERLAP:
+        {
+            int mode = std::clamp(static_cast<int>(newValue), 0, static_cast<int>(std::size(OVERLAP_FACTORS)) - 1);
+            if (mode != overlapMode.load())
+            {
+                overlapMode.store(mode);
+                needsReinit.store(true);
+            }
+            break;
+        }
+        default:
+            break;
     }
 }
 
 void FrequencyShifterProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    const auto prepareStart = std::chrono::steady_clock::now();
     currentSampleRate = sampleRate;
     currentBlockSize = samplesPerBlock;
 
@@ -672,11 +751,70 @@ void FrequencyShifterProcessor::prepareToPlay(double sampleRate, int samplesPerB
     envReleaseCoeff = std::exp(-1.0f / (static_cast<float>(sampleRate) * releaseTimeMs / 1000.0f));
 
     // Reset envelope states
-    inputEnvelope.fill(0.0f);
-    outputEnvelope.fill(0.0f);
+    for (auto& state : channelStates)
+    {
+        state.inputEnvelope = 0.0f;
+        state.outputEnvelope = 0.0f;
+    }
+
+    // Pick up the current parameter state before sizing the DSP
+    pollParameters();
+
+    // The audio thread is stopped, so build any objects the new geometry needs right
+    // here; whatever the builder thread had staged or was building is superseded
+    {
+        const std::lock_guard<std::mutex> lock(tableBuildMutex);
+        const auto geometry = getDspGeometry();
+        if (!dspObjectsMatch(geometry))
+        {
+            dspObjectStaging.geometry = geometry;
+            buildDspObjects();
+            dspObjectState.store(DSP_OBJECTS_STAGED, std::memory_order_release);
+        }
+        else
+        {
+            dspObjectState.store(DSP_OBJECTS_IDLE, std::memory_order_release);
+        }
+    }
+
+    // Visualization frame for BAND SPLIT, which a reinit may switch on from the audio thread
+    lowBandSpectrum.reserve(static_cast<size_t>(BAND_SPLIT_LOW_FFT_SIZE / 2 + 1));
 
     // Initialize with current quality mode
     reinitializeDsp();
+
+    // Build derived tables synchronously for the new sample rate; the audio thread
+    // is stopped here, so every retired version can be freed as well
+    tableSampleRate.store(sampleRate);
+    tablesNeedRebuild.store(true);
+    rebuildDerivedTables();
+    maskTables.reclaimAll();
+    delayTables.reclaimAll();
+
+    // Spectral delay lines as well, so a session that loads with DELAY on starts with
+    // it; any request still pending with the builder thread is dropped
+    {
+        const std::lock_guard<std::mutex> lock(tableBuildMutex);
+        if (delayEnabled.load())
+        {
+            for (auto& state : channelStates)
+            {
+                for (auto& delay : state.spectralDelays)
+                    delay.allocate();
+            }
+        }
+        delayLineState.store(DELAY_LINES_IDLE, std::memory_order_release);
+    }
+    updateMemoryReport();
+
+    if (!tableBuilderThread.isThreadRunning())
+        tableBuilderThread.startThread();
+
+    // Not on the audio thread here, so publish the latency synchronously
+    cancelPendingUpdate();
+    setLatencySamples(reportedLatencySamples.load());
+
+    recordSetupTime(SETUP_PREPARE, prepareStart);
 }
 
 int FrequencyShifterProcessor::fftSizeFromMs(float ms) const
@@ -730,101 +868,276 @@ void FrequencyShifterProcessor::getBlendParameters(float smearMsValue, int& fftS
     crossfade = 0.0f;
 }
 
-void FrequencyShifterProcessor::reinitializeDsp()
+FrequencyShifterProcessor::DspGeometry FrequencyShifterProcessor::getDspGeometry() const
 {
     // Get FFT size based on SMEAR setting (always snaps to nearest valid size)
-    float smear = smearMs.load();
     int fftSize1, fftSize2;
     float crossfade;
-    getBlendParameters(smear, fftSize1, fftSize2, crossfade);
-
-    currentFftSizes[0] = fftSize1;
-    currentFftSizes[1] = fftSize2;  // Same as fftSize1 after optimization
-    currentHopSizes[0] = fftSize1 / 4;  // Standard 75% overlap
-    currentHopSizes[1] = fftSize2 / 4;
-    currentCrossfade = crossfade;  // Always 0.0 after optimization
-
-    // OPTIMIZATION: Always single processor mode now (getBlendParameters sets fftSize1==fftSize2)
-    // This halves CPU usage compared to dual-processor crossfade approach
-    useSingleProcessor = true;
+    getBlendParameters(smearMs.load(), fftSize1, fftSize2, crossfade);
+
+    // BAND SPLIT: processor 1 becomes the decimated low band with a fixed long FFT
+    DspGeometry geometry;
+    geometry.bandSplit = bandSplitEnabled.load();
+    if (geometry.bandSplit)
+        fftSize2 = BAND_SPLIT_LOW_FFT_SIZE;
+
+    geometry.fftSizes = { fftSize1, fftSize2 };  // Same size unless BAND SPLIT
+    const int overlapFactor = OVERLAP_FACTORS[static_cast<size_t>(overlapMode.load())];
+    geometry.hopSizes = { fftSize1 / overlapFactor, fftSize2 / overlapFactor };  // Standard = 75% overlap
+    geometry.sampleRates = { currentSampleRate,
+                             geometry.bandSplit ? currentSampleRate / BAND_SPLIT_FACTOR : currentSampleRate };
+
+    // LOW LATENCY: asymmetric windows with the shortest synthesis window for this hop.
+    // Eco's hop is already half the FFT, so it stays symmetric (latency = fftSize).
+    geometry.asymmetricWindows = lowLatencyEnabled.load() && overlapFactor > 2;
+    for (size_t proc = 0; proc < NUM_PROCESSORS; ++proc)
+        geometry.frameLatencies[proc] = geometry.asymmetricWindows ? geometry.hopSizes[proc] * 2 : geometry.fftSizes[proc];
+
+    geometry.numChannels = std::min(getTotalNumInputChannels(), MAX_CHANNELS);
+    return geometry;
+}
 
-    const int numChannels = getTotalNumInputChannels();
+bool FrequencyShifterProcessor::dspObjectsMatch(const DspGeometry& geometry) const
+{
+    if (geometry.bandSplit && lowBandQuantizer == nullptr)
+        return false;
 
-    // Initialize DSP components for each channel and each processor
-    for (int ch = 0; ch < std::min(numChannels, MAX_CHANNELS); ++ch)
+    for (int ch = 0; ch < geometry.numChannels; ++ch)
     {
         for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
         {
-            int fftSize = currentFftSizes[proc];
-            int hopSize = currentHopSizes[proc];
-
-            stftProcessors[ch][proc] = std::make_unique<fshift::STFT>(fftSize, hopSize);
-            stftProcessors[ch][proc]->prepare(currentSampleRate);
-
-            phaseVocoders[ch][proc] = std::make_unique<fshift::PhaseVocoder>(fftSize, hopSize, currentSampleRate);
-
-            frequencyShifters[ch][proc] = std::make_unique<fshift::FrequencyShifter>(currentSampleRate, fftSize);
-
-            // Initialize overlap-add buffers
-            inputBuffers[ch][proc].resize(static_cast<size_t>(fftSize) * 2, 0.0f);
-            outputBuffers[ch][proc].resize(static_cast<size_t>(fftSize) * 2, 0.0f);
-            inputWritePos[ch][proc] = 0;
-            outputReadPos[ch][proc] = 0;
+            const auto p = static_cast<size_t>(proc);
+            const int fftSize = geometry.fftSizes[p];
+            const int hopSize = geometry.hopSizes[p];
+            const double procSampleRate = geometry.sampleRates[p];
+
+            const auto& stft = stftProcessors[ch][proc];
+            if (stft == nullptr || stft->getFFTSize() != fftSize || stft->getHopSize() != hopSize
+                || stft->getLatencySamples() != geometry.frameLatencies[p])
+                return false;
+
+            const auto& vocoder = phaseVocoders[ch][proc];
+            if (vocoder == nullptr || vocoder->getNumBins() != fftSize / 2 + 1
+                || vocoder->getHopSize() != hopSize || vocoder->getSampleRate() != procSampleRate)
+                return false;
+
+            const auto& shifter = frequencyShifters[ch][proc];
+            if (shifter == nullptr || shifter->getFFTSize() != fftSize || shifter->getSampleRate() != procSampleRate)
+                return false;
         }
-
-        // Initialize delay compensation buffer
-        // Fixed latency is MAX_FFT_SIZE samples, we add delay when using smaller FFT
-        delayCompBuffers[ch].resize(static_cast<size_t>(MAX_FFT_SIZE) * 2, 0.0f);
-        delayCompWritePos[ch] = 0;
-        delayCompReadPos[ch] = 0;
-
-        // Initialize dry signal delay buffer
-        // Dry signal must be delayed by full reported latency to align with wet
-        dryDelayBuffers[ch].resize(static_cast<size_t>(MAX_FFT_SIZE) + 1, 0.0f);
-        dryDelayWritePos[ch] = 0;
     }
+    return true;
+}
 
-    // Reset LFO phase
-    lfoPhase = 0.0;
-    lastRandomValue = 0.0f;
+bool FrequencyShifterProcessor::acquireDspObjects(const DspGeometry& geometry)
+{
+    const int state = dspObjectState.load(std::memory_order_acquire);
+    if (state == DSP_OBJECTS_REQUESTED)
+        return false;
 
-    // Prepare quantizer with primary FFT settings for phase continuity (Phase 2A.3)
-    if (quantizer)
+    if (state == DSP_OBJECTS_STAGED && dspObjectStaging.geometry == geometry)
     {
-        quantizer->prepare(currentSampleRate, currentFftSizes[0], currentHopSizes[0]);
+        for (int ch = 0; ch < geometry.numChannels; ++ch)
+        {
+            for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
+            {
+                std::swap(stftProcessors[ch][proc], dspObjectStaging.stfts[ch][proc]);
+                std::swap(phaseVocoders[ch][proc], dspObjectStaging.vocoders[ch][proc]);
+                std::swap(frequencyShifters[ch][proc], dspObjectStaging.shifters[ch][proc]);
+            }
+        }
+
+        // The staged quantizer is default-constructed; bring it up to the current settings
+        if (geometry.bandSplit && lowBandQuantizer == nullptr)
+        {
+            std::swap(lowBandQuantizer, dspObjectStaging.lowBandQuantizer);
+            lowBandQuantizer->setRootNote(rootNote.load());
+            lowBandQuantizer->setScaleType(static_cast<fshift::ScaleType>(scaleType.load()));
+            lowBandQuantizer->setPreserveAmount(preserveAmount.load());
+            lowBandQuantizer->setTransientAmount(transientAmount.load());
+            lowBandQuantizer->setTransientSensitivity(transientSensitivity.load());
+        }
+
+        // Envelope tables too, so the quantizers don't fetch them on the first frame
+        if (quantizer)
+            quantizer->adoptEnvelopeLookup(dspObjectStaging.envelopeLookups[0], geometry.sampleRates[0],
+                                           geometry.fftSizes[0]);
+        if (geometry.bandSplit)
+            lowBandQuantizer->adoptEnvelopeLookup(dspObjectStaging.envelopeLookups[1], geometry.sampleRates[1],
+                                                  geometry.fftSizes[1]);
+
+        dspObjectState.store(DSP_OBJECTS_IDLE, std::memory_order_release);
+        return true;
     }
 
-    // Pre-compute spectral mask curve with max FFT size
-    spectralMask.computeMaskCurve(currentSampleRate, MAX_FFT_SIZE);
-    maskNeedsUpdate.store(false);
+    // Nothing staged, or staged for a geometry a later parameter change replaced
+    dspObjectStaging.geometry = geometry;
+    dspObjectState.store(DSP_OBJECTS_REQUESTED, std::memory_order_release);
+    return false;
+}
 
-    // Prepare spectral delays for both processors
-    for (int ch = 0; ch < MAX_CHANNELS; ++ch)
+void FrequencyShifterProcessor::buildDspObjects()
+{
+    const auto& geometry = dspObjectStaging.geometry;
+    for (int ch = 0; ch < geometry.numChannels; ++ch)
     {
         for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
         {
-            int fftSize = currentFftSizes[proc];
-            int hopSize = currentHopSizes[proc];
-            spectralDelays[ch][proc].prepare(currentSampleRate, fftSize, hopSize);
-            spectralDelays[ch][proc].setDelayTime(delayTime.load());
-            spectralDelays[ch][proc].setFrequencySlope(delaySlope.load());
-            spectralDelays[ch][proc].setFeedback(0.0f);  // Disable spectral delay internal feedback
-            spectralDelays[ch][proc].setDamping(delayDamping.load());
-            spectralDelays[ch][proc].setMix(delayDiffuse.load());  // Spectral delay uses "mix" for diffuse amount
-            spectralDelays[ch][proc].setGain(delayGain.load());
+            const auto p = static_cast<size_t>(proc);
+            auto stft = std::make_unique<fshift::STFT>(geometry.fftSizes[p], geometry.hopSizes[p]);
+            stft->prepare(geometry.sampleRates[p]);
+            stft->setAsymmetricWindows(geometry.asymmetricWindows ? geometry.frameLatencies[p] : 0);
+            dspObjectStaging.stfts[ch][proc] = std::move(stft);
+
+            dspObjectStaging.vocoders[ch][proc] = std::make_unique<fshift::PhaseVocoder>(
+                geometry.fftSizes[p], geometry.hopSizes[p], geometry.sampleRates[p]);
+            dspObjectStaging.shifters[ch][proc] = std::make_unique<fshift::FrequencyShifter>(
+                geometry.sampleRates[p], geometry.fftSizes[p]);
         }
+    }
 
-        // Initialize time-domain feedback buffer for cascading pitch shifts
-        feedbackBuffers[static_cast<size_t>(ch)].resize(MAX_FEEDBACK_DELAY_SAMPLES, 0.0f);
-        feedbackWritePos[static_cast<size_t>(ch)] = 0;
-        feedbackFilterState[static_cast<size_t>(ch)] = 0.0f;
-
-        // Initialize Hilbert shifter for Classic mode
-        hilbertShifters[static_cast<size_t>(ch)].prepare(currentSampleRate);
-        hilbertShifters[static_cast<size_t>(ch)].reset();
+    dspObjectStaging.envelopeLookups[0] = fshift::MusicalQuantizer::acquireEnvelopeLookup(geometry.sampleRates[0],
+                                                                                          geometry.fftSizes[0]);
+    if (geometry.bandSplit)
+    {
+        dspObjectStaging.lowBandQuantizer = std::make_unique<fshift::MusicalQuantizer>(60, fshift::ScaleType::Major);
+        dspObjectStaging.envelopeLookups[1] = fshift::MusicalQuantizer::acquireEnvelopeLookup(geometry.sampleRates[1],
+                                                                                              geometry.fftSizes[1]);
     }
+}
 
-    // Calculate initial feedback filter coefficient (lowpass for damping)
+void FrequencyShifterProcessor::stageDspObjects()
+{
+    const std::lock_guard<std::mutex> lock(tableBuildMutex);
+
+    const int state = dspObjectState.load(std::memory_order_acquire);
+    if (state == DSP_OBJECTS_STAGED)
+        return;
+
+    if (state == DSP_OBJECTS_REQUESTED)
+    {
+        buildDspObjects();
+        dspObjectState.store(DSP_OBJECTS_STAGED, std::memory_order_release);
+        return;
+    }
+
+    // Whatever the audio thread swapped out or didn't adopt
+    for (auto& channelStfts : dspObjectStaging.stfts)
+        for (auto& stft : channelStfts)
+            stft.reset();
+    for (auto& channelVocoders : dspObjectStaging.vocoders)
+        for (auto& vocoder : channelVocoders)
+            vocoder.reset();
+    for (auto& channelShifters : dspObjectStaging.shifters)
+        for (auto& shifter : channelShifters)
+            shifter.reset();
+    dspObjectStaging.lowBandQuantizer.reset();
+    for (auto& lookup : dspObjectStaging.envelopeLookups)
+        lookup.reset();
+}
+
+void FrequencyShifterProcessor::reinitializeDsp()
+{
+    const auto reinitStart = std::chrono::steady_clock::now();
+
+    // Objects whose geometry is unchanged (repeated prepareToPlay during session load,
+    // or LOW LATENCY toggled in Eco) are reset and reused
+    const auto geometry = getDspGeometry();
+    if (!dspObjectsMatch(geometry) && !acquireDspObjects(geometry))
+        return;
+
+    bandSplitActive = geometry.bandSplit;
+    lowLatencyActive = lowLatencyEnabled.load();
+    currentFftSizes = geometry.fftSizes;
+    currentHopSizes = geometry.hopSizes;
+    currentFrameLatencies = geometry.frameLatencies;
+    processorSampleRates = geometry.sampleRates;
+    const int overlapFactor = currentFftSizes[0] / currentHopSizes[0];
+    currentCrossfade = 0.0f;  // getBlendParameters always snaps to a single FFT size
+
+    // BAND SPLIT: both bands come out of the crossover aligned to the slower of the two
+    // STFT paths, plus the crossover filters. Overlap-add output trails its input by one
+    // sample less than the frame latency, and that sample is a full BAND_SPLIT_FACTOR on
+    // the low band, so the bands are aligned on their actual delays.
+    const int highBandDelay = fshift::latency::getOlaPathDelay(currentFrameLatencies[0]);
+    const int lowBandDelay = fshift::latency::getOlaPathDelay(currentFrameLatencies[1]) * BAND_SPLIT_FACTOR;
+
+    // OPTIMIZATION: Always single processor mode now (getBlendParameters sets fftSize1==fftSize2)
+    // This halves CPU usage compared to dual-processor crossfade approach
+    useSingleProcessor = true;
+
+    // Reset the DSP components for each channel and each processor
+    for (int ch = 0; ch < geometry.numChannels; ++ch)
+    {
+        for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
+        {
+            auto& stft = *stftProcessors[ch][proc];
+            stft.reset();
+            stft.prepare(processorSampleRates[proc]);
+
+            // Eco overlap is too sparse for phase-difference frequency estimates;
+            // use single-frame reassignment instead
+            stft.setReassignmentEnabled(overlapFactor <= 2);
+
+            phaseVocoders[ch][proc]->reset();
+        }
+
+        // Delay whichever band finishes first so the recombined bands line up
+        channelStates[static_cast<size_t>(ch)].bandSplitter.prepare(BAND_SPLIT_FACTOR,
+                                                                    std::max(0, lowBandDelay - highBandDelay),
+                                                                    std::max(0, highBandDelay - lowBandDelay));
+    }
+
+    // The rest of the engine (delay compensation, feedback timing) sees the split as one path
+    if (bandSplitActive)
+        currentFrameLatencies[0] = BAND_SPLIT_LATENCY + std::max(highBandDelay, lowBandDelay) + 1;
+
+    // Reset LFO phase
+    lfoPhase = 0.0;
+    lastRandomValue = 0.0f;
+
+    // Prepare quantizer with primary FFT settings for phase continuity (Phase 2A.3)
+    if (quantizer)
+    {
+        quantizer->prepare(currentSampleRate, currentFftSizes[0], currentHopSizes[0]);
+    }
+
+    // BAND SPLIT: the low band needs its own bin mapping and phase history
+    if (bandSplitActive)
+    {
+        lowBandQuantizer->prepare(processorSampleRates[1], currentFftSizes[1], currentHopSizes[1]);
+        lowBandSpectrum.assign(static_cast<size_t>(currentFftSizes[1] / 2 + 1), 0.0f);
+        lowBandNoteMagnitudes.fill(0.0f);
+    }
+    else
+    {
+        lowBandSpectrum.clear();
+    }
+
+    // Prepare spectral delays for both processors
+    for (int ch = 0; ch < MAX_CHANNELS; ++ch)
+    {
+        for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
+        {
+            int fftSize = currentFftSizes[proc];
+            int hopSize = currentHopSizes[proc];
+            channelStates[ch].spectralDelays[proc].prepare(processorSampleRates[proc], fftSize, hopSize);
+            channelStates[ch].spectralDelays[proc].setDelayTime(delayTime.load());
+            channelStates[ch].spectralDelays[proc].setFeedback(0.0f);  // Disable spectral delay internal feedback
+            channelStates[ch].spectralDelays[proc].setMix(delayDiffuse.load());  // Spectral delay uses "mix" for diffuse amount
+            channelStates[ch].spectralDelays[proc].setGain(delayGain.load());
+        }
+
+        // Reset time-domain feedback filters (the feedback line is laid out below)
+        channelStates[static_cast<size_t>(ch)].floatLines.resetFeedbackFilters();
+        channelStates[static_cast<size_t>(ch)].doubleLines.resetFeedbackFilters();
+
+        // Initialize Hilbert shifter for Classic mode
+        channelStates[static_cast<size_t>(ch)].hilbertShifter.prepare(currentSampleRate);
+        channelStates[static_cast<size_t>(ch)].hilbertShifter.reset();
+    }
+
+    // Calculate initial feedback filter coefficient (lowpass for damping)
     float dampNorm = delayDamping.load() / 100.0f;
     float cutoffHz = 12000.0f * std::pow(1000.0f / 12000.0f, dampNorm);
     feedbackFilterCoeff = std::exp(-2.0f * static_cast<float>(M_PI) * cutoffHz / static_cast<float>(currentSampleRate));
@@ -849,7 +1162,7 @@ void FrequencyShifterProcessor::reinitializeDsp()
         // Reset WARM filter state
         for (int ch = 0; ch < MAX_CHANNELS; ++ch)
         {
-            warmFilterState[static_cast<size_t>(ch)].fill(0.0f);
+            channelStates[static_cast<size_t>(ch)].warmFilterState.fill(0.0f);
         }
     }
 
@@ -869,12 +1182,6 @@ void FrequencyShifterProcessor::reinitializeDsp()
         feedbackHpfCoeffs[2] = (1.0f + cosOmega) / 2.0f / a0;  // b2
         feedbackHpfCoeffs[3] = -(-2.0f * cosOmega) / a0;        // -a1 (negated for direct form)
         feedbackHpfCoeffs[4] = -(1.0f - alpha) / a0;            // -a2 (negated for direct form)
-
-        // Reset HPF state
-        for (int ch = 0; ch < MAX_CHANNELS; ++ch)
-        {
-            feedbackHpfState[static_cast<size_t>(ch)].fill(0.0f);
-        }
     }
 
     // Calculate 4-pole lowpass filter coefficients (~4kHz, 24dB/oct Linkwitz-Riley)
@@ -899,13 +1206,14 @@ void FrequencyShifterProcessor::reinitializeDsp()
         // Reset both LPF stages
         for (int ch = 0; ch < MAX_CHANNELS; ++ch)
         {
-            feedbackLpf1State[static_cast<size_t>(ch)].fill(0.0f);
-            feedbackLpf2State[static_cast<size_t>(ch)].fill(0.0f);
+            channelStates[static_cast<size_t>(ch)].feedbackLpf1State.fill(0.0f);
+            channelStates[static_cast<size_t>(ch)].feedbackLpf2State.fill(0.0f);
         }
     }
 
     // Reset cross-coupled feedback and drift LFO
-    crossFeedbackSample.fill(0.0f);
+    for (auto& state : channelStates)
+        state.crossFeedbackSample = 0.0f;
     driftLfoPhase = 0.0;
 
     // Calculate Eventide-style 4th order Butterworth LPF coefficients for feedback filtering
@@ -939,29 +1247,126 @@ void FrequencyShifterProcessor::reinitializeDsp()
         classicFbLpfCoeffs[7] = ((1.0f - cosOmega) / 2.0f) / a0_2;  // b2
         classicFbLpfCoeffs[8] = -(-2.0f * cosOmega) / a0_2;          // -a1
         classicFbLpfCoeffs[9] = -(1.0f - alpha2) / a0_2;             // -a2
-
-        // Reset Eventide-style feedback filter states
-        for (int ch = 0; ch < MAX_CHANNELS; ++ch)
-        {
-            classicDcBlockState[static_cast<size_t>(ch)] = 0.0f;
-            classicFbLpfState[static_cast<size_t>(ch)].fill(0.0f);
-        }
     }
 
     // Initialize stereo decorrelation buffer (0.06ms delay for left channel)
     // This reduces phase-locked resonance between L/R channels
     decorrelateDelaySamples = static_cast<int>(0.00006f * currentSampleRate + 0.5f);
-    leftDecorrelateBuffer.resize(static_cast<size_t>(decorrelateDelaySamples + 4), 0.0f);
-    decorrelateWritePos = 0;
 
-    // Report latency based on current mode
+    // Carve every ring buffer (cleared) out of the shared arena
+    layoutBuffers(geometry.numChannels);
+    updateMemoryReport();
+
+    // Fresh engine state: leave true bypass
+    spectralBypassGain = 0.0f;
+    spectralEngineSuspended = false;
+    spectralWarmupSamples = 0;
+
+    // Both channels start from identical fresh state; re-detect dual mono
+    monoFastPathActive = false;
+    monoMatchBlocks = 0;
+
+    // Report latency based on current mode (published from the message thread)
     int currentMode = processingMode.load();
-    setLatencySamples(currentMode == 0 ? CLASSIC_MODE_LATENCY : MAX_FFT_SIZE);
+    requestLatencyUpdate(currentMode == 0 ? CLASSIC_MODE_LATENCY : getSpectralLatencySamples());
     needsReinit.store(false);
+
+    numReinits.fetch_add(1, std::memory_order_relaxed);
+    recordSetupTime(SETUP_REINIT, reinitStart);
+}
+
+bool FrequencyShifterProcessor::spectralDelaysAllocated() const
+{
+    for (const auto& state : channelStates)
+    {
+        for (const auto& delay : state.spectralDelays)
+        {
+            if (!delay.isAllocated())
+                return false;
+        }
+    }
+    return true;
+}
+
+void FrequencyShifterProcessor::requestSpectralDelayLines()
+{
+    // Every channel shares its processor's geometry
+    for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
+    {
+        const auto& delay = channelStates[0].spectralDelays[proc];
+        delayLineStaging.numBins[static_cast<size_t>(proc)] = delay.getNumBins();
+        delayLineStaging.delayMasks[static_cast<size_t>(proc)] = delay.getDelayMask();
+    }
+    delayLineState.store(DELAY_LINES_REQUESTED, std::memory_order_release);
+}
+
+void FrequencyShifterProcessor::stageSpectralDelayLines()
+{
+    const std::lock_guard<std::mutex> lock(tableBuildMutex);
+
+    const int state = delayLineState.load(std::memory_order_acquire);
+    if (state == DELAY_LINES_STAGED)
+        return;
+
+    for (auto& channelLines : delayLineStaging.lines)
+    {
+        for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
+        {
+            auto& lines = channelLines[static_cast<size_t>(proc)];
+            if (state == DELAY_LINES_REQUESTED)
+                fshift::SpectralDelay::allocateLines(lines, delayLineStaging.numBins[static_cast<size_t>(proc)],
+                                                     delayLineStaging.delayMasks[static_cast<size_t>(proc)]);
+            else
+                lines = {};  // Whatever the audio thread swapped out or didn't adopt
+        }
+    }
+
+    if (state == DELAY_LINES_REQUESTED)
+        delayLineState.store(DELAY_LINES_STAGED, std::memory_order_release);
+}
+
+void FrequencyShifterProcessor::adoptSpectralDelayLines()
+{
+    // Lines staged for a geometry that a rebuild has since replaced are left behind;
+    // the next block requests lines for the new geometry
+    for (int ch = 0; ch < MAX_CHANNELS; ++ch)
+    {
+        for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
+        {
+            auto& delay = channelStates[static_cast<size_t>(ch)].spectralDelays[proc];
+            if (!delay.isAllocated())
+                delay.adoptLines(delayLineStaging.lines[static_cast<size_t>(ch)][static_cast<size_t>(proc)]);
+        }
+    }
+    delayLineState.store(DELAY_LINES_IDLE, std::memory_order_release);
+    updateMemoryReport();
+}
+
+void FrequencyShifterProcessor::resumeSpectralEngine()
+{
+    for (int ch = 0; ch < MAX_CHANNELS; ++ch)
+    {
+        for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
+        {
+            // Input buffers kept being fed while suspended, so analysis history is intact
+            channelStates[ch].outputBuffers[proc].clear();
+            if (stftProcessors[ch][proc])
+                stftProcessors[ch][proc]->reset();
+            if (phaseVocoders[ch][proc])
+                phaseVocoders[ch][proc]->reset();
+        }
+        channelStates[ch].floatLines.delayCompBuffer.clear();
+        channelStates[ch].doubleLines.delayCompBuffer.clear();
+        channelStates[ch].bandSplitter.clearOutput();
+    }
+
+    spectralEngineSuspended = false;
 }
 
 void FrequencyShifterProcessor::releaseResources()
 {
+    tableBuilderThread.stopThread(1000);
+
     for (int ch = 0; ch < MAX_CHANNELS; ++ch)
     {
         for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
@@ -969,12 +1374,238 @@ void FrequencyShifterProcessor::releaseResources()
             stftProcessors[ch][proc].reset();
             phaseVocoders[ch][proc].reset();
             frequencyShifters[ch][proc].reset();
-            inputBuffers[ch][proc].clear();
-            outputBuffers[ch][proc].clear();
+            channelStates[ch].inputBuffers[proc].release();
+            channelStates[ch].outputBuffers[proc].release();
         }
-        delayCompBuffers[ch].clear();
-        dryDelayBuffers[ch].clear();
+        channelStates[ch].floatLines.release();
+        channelStates[ch].doubleLines.release();
     }
+    leftDecorrelateBuffer.release();
+    bufferArena.release();
+    updateMemoryReport();
+}
+
+void FrequencyShifterProcessor::layoutBuffers(int numChannels)
+{
+    // The same layout runs twice: measure, then carve spans from the committed block.
+    // Channels that are not in use are detached so nothing points at reused memory.
+    // The measuring pass sizes the frame buffers for MAX_FFT_SIZE, so the block is
+    // allocated for the worst case in prepareToPlay and a reinit on the audio thread
+    // (SMEAR, OVERLAP, BAND SPLIT) only re-carves it.
+    auto place = [this]<typename Sample>(fshift::RingBuffer<Sample>& ring, int minimumCapacity, int mirrorLength)
+    {
+        auto* memory = bufferArena.allocate<Sample>(static_cast<size_t>(
+            fshift::RingBuffer<Sample>::getStorageSize(minimumCapacity, mirrorLength)));
+        if (!bufferArena.isMeasuring())
+            ring.attach(memory, minimumCapacity, mirrorLength);
+    };
+
+    // Block scratch: one span of the prepared block size
+    const int blockSize = std::max(1, currentBlockSize);
+    auto placeScratch = [this, blockSize]<typename Sample>(std::span<Sample>& scratch)
+    {
+        auto* memory = bufferArena.allocate<Sample>(static_cast<size_t>(blockSize));
+        if (!bufferArena.isMeasuring())
+            scratch = { memory, static_cast<size_t>(blockSize) };
+    };
+
+    // Host-precision lines: only the set matching the processing precision gets memory
+    auto placeSampleLines = [&](auto& lines, bool active)
+    {
+        if (active)
+        {
+            placeScratch(lines.drySignal);
+
+            // Fixed latency is MAX_FFT_SIZE samples, we add delay when using smaller FFT
+            // (LOW LATENCY reports the frame latency, so only the OLA's missing sample)
+            place(lines.delayCompBuffer, MAX_FFT_SIZE * 2, 0);
+
+            // Dry signal must be delayed by full reported latency to align with wet
+            place(lines.dryDelayBuffer, MAX_FFT_SIZE + BAND_SPLIT_LATENCY + 1, 0);
+        }
+        else if (!bufferArena.isMeasuring())
+        {
+            lines.delayCompBuffer.release();
+            lines.dryDelayBuffer.release();
+            lines.drySignal = {};
+        }
+
+        // Feedback lines exist for every channel (feedbackBuffersSilent checks them all)
+        place(lines.feedbackBuffer, MAX_FEEDBACK_DELAY_SAMPLES, 0);
+    };
+    const bool doublePrecision = isUsingDoublePrecision();
+
+    bufferArena.beginMeasure();
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (int ch = 0; ch < MAX_CHANNELS; ++ch)
+        {
+            auto& state = channelStates[static_cast<size_t>(ch)];
+            const bool active = ch < numChannels;
+
+            for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
+            {
+                const int fftSize = bufferArena.isMeasuring() ? MAX_FFT_SIZE : currentFftSizes[proc];
+                if (active)
+                {
+                    place(state.inputBuffers[proc], fftSize * 2, fftSize);
+                    place(state.outputBuffers[proc], fftSize * 2, 0);
+                    state.hopPhases[static_cast<size_t>(proc)] = 0;
+                }
+                else if (!bufferArena.isMeasuring())
+                {
+                    state.inputBuffers[proc].release();
+                    state.outputBuffers[proc].release();
+                }
+            }
+
+            if (active)
+            {
+                // The float copy of the dry input is only needed when the host runs in double
+                if (doublePrecision)
+                    placeScratch(state.engineInput);
+                else if (!bufferArena.isMeasuring())
+                    state.engineInput = {};
+
+                placeScratch(state.feedbackInput);
+                placeScratch(state.classicOutput);
+                for (auto& output : state.procOutputs)
+                    placeScratch(output);
+            }
+            else if (!bufferArena.isMeasuring())
+            {
+                state.engineInput = {};
+                state.feedbackInput = {};
+                state.classicOutput = {};
+                state.procOutputs = {};
+            }
+
+            if (doublePrecision)
+            {
+                placeSampleLines(state.doubleLines, active);
+                if (!bufferArena.isMeasuring())
+                    state.floatLines.release();
+            }
+            else
+            {
+                placeSampleLines(state.floatLines, active);
+                if (!bufferArena.isMeasuring())
+                    state.doubleLines.release();
+            }
+            state.feedbackSilentRun = state.getFeedbackCapacity();
+        }
+
+        place(leftDecorrelateBuffer, decorrelateDelaySamples + 4, 0);
+
+        if (pass == 0)
+            bufferArena.commit();
+    }
+
+    // STEREO LINK scratch, sized here so linking never allocates on the audio thread
+    // (capacity for MAX_FFT_SIZE, so a reinit never grows it either)
+    for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
+    {
+        const auto numBins = static_cast<size_t>(currentFftSizes[proc] / 2 + 1);
+        linkedMagnitude[static_cast<size_t>(proc)].reserve(static_cast<size_t>(MAX_FFT_SIZE / 2 + 1));
+        linkedPeaks[static_cast<size_t>(proc)].reserve(static_cast<size_t>(MAX_FFT_SIZE / 2 + 1));
+        linkedMagnitude[static_cast<size_t>(proc)].assign(numBins, 0.0f);
+        linkedPeaks[static_cast<size_t>(proc)].assign(numBins, false);
+    }
+}
+
+void FrequencyShifterProcessor::updateMemoryReport()
+{
+    std::array<size_t, NUM_MEMORY_SUBSYSTEMS> bytes{};
+    bytes[MEM_RING_BUFFERS] = bufferArena.getCapacityBytes();
+    bytes[MEM_CHANNEL_STATE] = sizeof(channelStates);
+    bytes[MEM_QUANTIZER] = quantizer ? quantizer->getMemoryBytes() : 0;
+
+    for (int ch = 0; ch < MAX_CHANNELS; ++ch)
+    {
+        for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
+        {
+            if (stftProcessors[ch][proc])
+                bytes[MEM_STFT] += sizeof(fshift::STFT) + stftProcessors[ch][proc]->getMemoryBytes();
+            if (phaseVocoders[ch][proc])
+                bytes[MEM_PHASE_VOCODER] += sizeof(fshift::PhaseVocoder) + phaseVocoders[ch][proc]->getMemoryBytes();
+            if (frequencyShifters[ch][proc])
+                bytes[MEM_FREQUENCY_SHIFTER] += sizeof(fshift::FrequencyShifter) + frequencyShifters[ch][proc]->getMemoryBytes();
+            bytes[MEM_SPECTRAL_DELAY] += channelStates[ch].spectralDelays[proc].getMemoryBytes();
+        }
+        bytes[MEM_RING_BUFFERS] += channelStates[ch].bandSplitter.getMemoryBytes();
+    }
+    if (lowBandQuantizer)
+        bytes[MEM_QUANTIZER] += lowBandQuantizer->getMemoryBytes();
+
+    // Every channel references the same shared tables, so count channel 0 only
+    for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
+    {
+        if (stftProcessors[0][proc])
+            bytes[MEM_SHARED_TABLES] += stftProcessors[0][proc]->getSharedMemoryBytes();
+        if (phaseVocoders[0][proc])
+            bytes[MEM_SHARED_TABLES] += phaseVocoders[0][proc]->getSharedMemoryBytes();
+    }
+    if (quantizer)
+        bytes[MEM_SHARED_TABLES] += quantizer->getSharedMemoryBytes();
+    if (lowBandQuantizer)
+        bytes[MEM_SHARED_TABLES] += lowBandQuantizer->getSharedMemoryBytes();
+
+    for (size_t i = 0; i < bytes.size(); ++i)
+        memoryReportBytes[i].store(bytes[i], std::memory_order_relaxed);
+}
+
+FrequencyShifterProcessor::MemoryReport FrequencyShifterProcessor::getMemoryReport() const
+{
+    MemoryReport report;
+    for (size_t i = 0; i < report.bytes.size(); ++i)
+        report.bytes[i] = memoryReportBytes[i].load(std::memory_order_relaxed);
+    return report;
+}
+
+void FrequencyShifterProcessor::recordSetupTime(SetupStage stage, std::chrono::steady_clock::time_point start)
+{
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    setupMicros[static_cast<size_t>(stage)].store(std::chrono::duration<double, std::micro>(elapsed).count(),
+                                                  std::memory_order_relaxed);
+}
+
+FrequencyShifterProcessor::SetupTimings FrequencyShifterProcessor::getSetupTimings() const
+{
+    SetupTimings timings;
+    for (size_t i = 0; i < timings.lastMicros.size(); ++i)
+        timings.lastMicros[i] = setupMicros[i].load(std::memory_order_relaxed);
+    timings.numReinits = numReinits.load(std::memory_order_relaxed);
+    return timings;
+}
+
+const char* FrequencyShifterProcessor::getSetupStageName(int stage)
+{
+    switch (stage)
+    {
+        case SETUP_CONSTRUCT:   return "Construct";
+        case SETUP_PREPARE:     return "PrepareToPlay";
+        case SETUP_REINIT:      return "ReinitializeDsp";
+        case SETUP_SET_STATE:   return "SetStateInformation";
+        default:                break;
+    }
+    return "Unknown";
+}
+
+const char* FrequencyShifterProcessor::getMemorySubsystemName(int subsystem)
+{
+    switch (subsystem)
+    {
+        case MEM_RING_BUFFERS:      return "RingBuffers";
+        case MEM_CHANNEL_STATE:     return "ChannelState";
+        case MEM_STFT:              return "STFT";
+        case MEM_PHASE_VOCODER:     return "PhaseVocoder";
+        case MEM_FREQUENCY_SHIFTER: return "FrequencyShifter";
+        case MEM_SPECTRAL_DELAY:    return "SpectralDelay";
+        case MEM_QUANTIZER:         return "Quantizer";
+        case MEM_SHARED_TABLES:     return "SharedTables";
+        default:                    break;
+    }
+    return "Unknown";
 }
 
 bool FrequencyShifterProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
@@ -992,45 +1623,85 @@ bool FrequencyShifterProcessor::isBusesLayoutSupported(const BusesLayout& layout
 }
 
 void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+{
+    processInPreparedBlocks(buffer);
+}
+
+void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<double>& buffer, juce::MidiBuffer&)
+{
+    processInPreparedBlocks(buffer);
+}
+
+template <typename SampleType>
+void FrequencyShifterProcessor::processInPreparedBlocks(juce::AudioBuffer<SampleType>& buffer)
+{
+    const int numSamples = buffer.getNumSamples();
+    const int blockSize = std::max(1, currentBlockSize);
+    if (numSamples <= blockSize)
+    {
+        processBlockImpl(buffer);
+        return;
+    }
+
+    // Sub-buffers refer to the host's channel data, so splitting copies nothing
+    for (int start = 0; start < numSamples; start += blockSize)
+    {
+        juce::AudioBuffer<SampleType> piece(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), start,
+                                            std::min(blockSize, numSamples - start));
+        processBlockImpl(piece);
+    }
+}
+
+template <typename SampleType>
+void FrequencyShifterProcessor::processBlockImpl(juce::AudioBuffer<SampleType>& buffer)
 {
     juce::ScopedNoDenormals noDenormals;
 
+    // Measure this block against its deadline (recorded on every return path)
+    fshift::BlockTimingMonitor::ScopedBlock blockTiming(blockTimingMonitor, buffer.getNumSamples(), currentSampleRate);
+
+    // Ring buffers are laid out in prepareToPlay for the processing precision; leave audio
+    // untouched while released (or if a host calls the other overload)
+    if (channelStates[0].getLines<SampleType>().feedbackBuffer.isEmpty())
+        return;
+
+    // Apply any parameter changes since the last block (may request a reinit)
+    pollParameters();
+
     // Check if we need to reinitialize DSP (SMEAR changed)
     if (needsReinit.load())
     {
         reinitializeDsp();
+        blockTiming.setFlag(fshift::BlockTimingMonitor::Reinit);
     }
 
-    // Update mask curve if parameters changed (use primary FFT size)
-    // Apply stored atomic values here in audio thread for thread safety
-    if (maskNeedsUpdate.load())
-    {
-        spectralMask.setMode(static_cast<fshift::SpectralMask::Mode>(maskMode.load()));
-        spectralMask.setLowFreq(maskLowFreq.load());
-        spectralMask.setHighFreq(maskHighFreq.load());
-        spectralMask.setTransition(maskTransition.load());
-        spectralMask.computeMaskCurve(currentSampleRate, currentFftSizes[0]);
-        maskNeedsUpdate.store(false);
-    }
+    // Spectral delay lines come from the table builder thread; until they are adopted
+    // the delay stays off and the block is processed without it
+    const int delayLineStatus = delayLineState.load(std::memory_order_acquire);
+    if (delayLineStatus == DELAY_LINES_STAGED)
+        adoptSpectralDelayLines();
+    else if (delayLineStatus == DELAY_LINES_IDLE && delayEnabled.load() && !spectralDelaysAllocated())
+        requestSpectralDelayLines();
+
+    // Latest derived tables from the builder thread, held until the next block
+    const std::vector<float>* maskCurve = maskTables.acquire();
+    const fshift::SpectralDelay::Tables* delayCurves = delayTables.acquire();
 
     // Apply deferred spectral delay updates in audio thread for thread safety
     if (delayNeedsUpdate.load())
     {
         float currentDelayTime = delayTime.load();
-        float currentDelaySlope = delaySlope.load();
         float currentDelayFeedback = delayFeedback.load();
         float currentDelayDamping = delayDamping.load();
         float currentDelayDiffuse = delayDiffuse.load();
         float currentDelayGainDb = delayGain.load();
 
-        for (auto& chDelays : spectralDelays)
+        for (auto& state : channelStates)
         {
-            for (auto& delay : chDelays)
+            for (auto& delay : state.spectralDelays)
             {
                 delay.setDelayTime(currentDelayTime);
-                delay.setFrequencySlope(currentDelaySlope);
                 delay.setFeedback(currentDelayFeedback / 100.0f);
-                delay.setDamping(currentDelayDamping);
                 delay.setMix(currentDelayDiffuse);
                 delay.setGain(currentDelayGainDb);
             }
@@ -1063,7 +1734,7 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     const bool currentLfoSync = lfoSync.load();
     const int currentLfoDivision = lfoDivision.load();
     const int currentLfoShape = lfoShape.load();
-    const bool currentDelayEnabled = delayEnabled.load();
+    const bool currentDelayEnabled = delayEnabled.load() && spectralDelaysAllocated();
     const bool currentDelaySync = delaySync.load();
     const int currentDelayDivision = delayDivision.load();
     const float currentFeedbackAmount = delayFeedback.load() / 100.0f;  // 0-0.95
@@ -1124,7 +1795,7 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
         double latencyCompensationPhase = 0.0;
         if (currentLfoSync)
         {
-            int fftLatencySamples = currentFftSizes[0];
+            int fftLatencySamples = currentFrameLatencies[0];
             latencyCompensationPhase = (static_cast<double>(fftLatencySamples) / currentSampleRate) * lfoFreqHz;
         }
 
@@ -1229,7 +1900,7 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
         double dlyLatencyCompensationPhase = 0.0;
         if (currentDlyLfoSync)
         {
-            int fftLatencySamples = currentFftSizes[0];
+            int fftLatencySamples = currentFrameLatencies[0];
             dlyLatencyCompensationPhase = (static_cast<double>(fftLatencySamples) / currentSampleRate) * dlyLfoFreqHz;
         }
 
@@ -1276,6 +1947,45 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     // Apply delay time modulation and clamp to valid range (10ms - 2000ms)
     const float modulatedDelayTimeMs = std::clamp(currentDelayTimeMs + dlyLfoModulationMs, 10.0f, 2000.0f);
 
+    // === SILENCE SUSPENSION ===
+    // Vectorized block peak scan of the input. LFO phases above keep advancing, so
+    // modulation stays in time while suspended.
+    const bool inputSilent = buffer.getMagnitude(0, numSamples) < SILENCE_THRESHOLD;
+    if (!inputSilent || needsModeSwitch.load())
+    {
+        if (silenceSuspended)
+        {
+            // All buffers hold (near) silence, so processing simply resumes where it
+            // stopped; only the phase vocoders need fresh phase history
+            for (auto& chVocoders : phaseVocoders)
+                for (auto& vocoder : chVocoders)
+                    if (vocoder)
+                        vocoder->reset();
+            silenceSuspended = false;
+        }
+        silentSampleCount = 0;
+    }
+    else if (!silenceSuspended
+             && silentSampleCount >= getSilenceTailSamples(currentDelayEnabled, modulatedDelayTimeMs)
+             && (!currentDelayEnabled || feedbackBuffersSilent()))
+    {
+        silenceSuspended = true;
+
+        // Whatever the delay lines still hold is inaudible (or stale, if DELAY was
+        // switched off with content in them), so resuming starts from empty lines
+        clearDelayLines();
+
+        // Clear the analyzer rather than freezing the last frame
+        publishSpectrum({});
+    }
+
+    if (silenceSuspended)
+    {
+        buffer.clear();
+        advanceDriftLfo(numSamples);
+        return;
+    }
+
     // Cache crossfade value
     const float crossfade = currentCrossfade;
     const bool singleProc = useSingleProcessor;
@@ -1286,395 +1996,768 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     // === Mode Switching Logic ===
     const int currentMode = processingMode.load();
     const bool switching = needsModeSwitch.load();
+    if (switching)
+        blockTiming.setFlag(fshift::BlockTimingMonitor::ModeSwitch);
 
     // Calculate mode crossfade rate (samples to complete transition)
     const float modeCrossfadeRate = 1.0f / (MODE_CROSSFADE_MS * 0.001f * static_cast<float>(currentSampleRate));
 
+    // Latency of the Spectral path (MAX_FFT_SIZE, or frame latency in LOW LATENCY)
+    const int spectralLatency = getSpectralLatencySamples();
+
     // If mode switch completed, update latency and finalize
     if (switching && modeCrossfadeProgress >= 1.0f)
     {
         processingMode.store(targetMode);
         needsModeSwitch.store(false);
         modeCrossfadeProgress = 1.0f;
-        setLatencySamples(targetMode == 0 ? CLASSIC_MODE_LATENCY : MAX_FFT_SIZE);
+        requestLatencyUpdate(targetMode == 0 ? CLASSIC_MODE_LATENCY : spectralLatency);
     }
 
     // Determine active mode (use target mode once crossfade is complete)
     const bool useClassicMode = switching ? (targetMode == 0) : (currentMode == 0);
     const bool useSpectralMode = switching ? (previousMode == 1 || targetMode == 1) : (currentMode == 1);
 
+    // === TRUE BYPASS (Spectral) ===
+    // Crossfade to the latency-matched dry line, then stop running STFT frames.
+    // On resume the OLA buffers are flushed and the dry line is held until the
+    // engine output is valid again (spectralLatency samples), then crossfaded back.
+    const bool wantSpectralBypass = bypassProcessing && !currentDelayEnabled && !switching && currentMode == 1;
+    const float bypassGainStart = spectralBypassGain;
+    const float bypassGainStep = static_cast<float>(numSamples)
+        / (BYPASS_CROSSFADE_MS * 0.001f * static_cast<float>(currentSampleRate));
+
+    if (wantSpectralBypass)
+    {
+        // Whole block is already latency-matched dry: skip the engine
+        spectralEngineSuspended = bypassGainStart >= 1.0f;
+        spectralBypassGain = std::min(1.0f, spectralBypassGain + bypassGainStep);
+    }
+    else
+    {
+        if (spectralEngineSuspended)
+        {
+            resumeSpectralEngine();
+            spectralWarmupSamples = spectralLatency;
+        }
+
+        if (spectralWarmupSamples > 0)
+            spectralWarmupSamples -= numSamples;
+        else
+            spectralBypassGain = std::max(0.0f, spectralBypassGain - bypassGainStep);
+    }
+
+    const float bypassGainEnd = spectralBypassGain;
+    const bool applyBypassBlend = bypassGainStart > 0.0f || bypassGainEnd > 0.0f;
+
+    // === DUAL-MONO FAST PATH ===
+    const bool monoEligible = numChannels == 2 && !stereoDecorrelateEnabled.load() && !switching;
+    const bool inputChannelsMatch = monoEligible
+        && channelsMatch(buffer.getReadPointer(0), buffer.getReadPointer(1), numSamples);
+
+    if (!inputChannelsMatch)
+    {
+        if (monoFastPathActive)
+        {
+            // Right channel state stood still while bypassed; continue from the left's
+            syncChannelState(0, 1);
+            monoFastPathActive = false;
+        }
+        monoMatchBlocks = 0;
+    }
+    else if (!monoFastPathActive && monoMatchBlocks >= MONO_ENTER_BLOCKS)
+    {
+        monoFastPathActive = true;
+    }
+
+    const int numProcessedChannels = monoFastPathActive ? 1 : std::min(numChannels, MAX_CHANNELS);
+    const bool linkStereoPeaks = stereoLinkEnabled.load() && numProcessedChannels == 2;
+
+    // Channels are processed in three passes (input and Classic, Spectral, mixing) so that
+    // STEREO LINK can run both channels' spectral frames for a hop side by side
+    // (block scratch lives in each ChannelState; processInPreparedBlocks keeps numSamples within it)
+    std::array<std::span<SampleType>, MAX_CHANNELS> drySignals;
+    std::array<std::span<float>, MAX_CHANNELS> classicOutputs;
+    std::array<std::span<float>, MAX_CHANNELS> proc0Outputs;
+    std::array<std::span<float>, MAX_CHANNELS> proc1Outputs;
+
+    // The spectral engine and Classic shifter take float input: a 64-bit host's dry signal
+    // is converted once for them, a 32-bit host's is used as is
+    std::array<std::span<float>, MAX_CHANNELS> convertedInputs;
+    auto engineInput = [&](int channel) -> std::span<const float>
+    {
+        if constexpr (std::is_same_v<SampleType, float>)
+            return drySignals[static_cast<size_t>(channel)];
+        else
+            return convertedInputs[static_cast<size_t>(channel)];
+    };
+
     // Process each channel
-    for (int channel = 0; channel < std::min(numChannels, MAX_CHANNELS); ++channel)
+    for (int channel = 0; channel < numProcessedChannels; ++channel)
     {
         auto* channelData = buffer.getWritePointer(channel);
-
-        // Store dry signal for mixing
-        std::vector<float> drySignal(channelData, channelData + numSamples);
+        auto& state = channelStates[static_cast<size_t>(channel)];
+        const auto blockLength = static_cast<size_t>(numSamples);
+
+        // Store dry signal for mixing, at the host's precision
+        auto& drySignal = drySignals[static_cast<size_t>(channel)];
+        drySignal = state.getLines<SampleType>().drySignal.first(blockLength);
+        std::copy(channelData, channelData + numSamples, drySignal.begin());
+        if constexpr (!std::is_same_v<SampleType, float>)
+        {
+            auto& converted = convertedInputs[static_cast<size_t>(channel)];
+            converted = state.engineInput.first(blockLength);
+            for (int i = 0; i < numSamples; ++i)
+                converted[static_cast<size_t>(i)] = static_cast<float>(drySignal[static_cast<size_t>(i)]);
+        }
 
         // Temp buffers for outputs
-        std::vector<float> classicOutput(static_cast<size_t>(numSamples), 0.0f);
-        std::vector<float> proc0Output(static_cast<size_t>(numSamples), 0.0f);
-        std::vector<float> proc1Output(static_cast<size_t>(numSamples), 0.0f);
+        auto& classicOutput = classicOutputs[static_cast<size_t>(channel)];
+        classicOutput = state.classicOutput.first(blockLength);
+        proc0Outputs[static_cast<size_t>(channel)] = state.procOutputs[0].first(blockLength);
+        proc1Outputs[static_cast<size_t>(channel)] = state.procOutputs[1].first(blockLength);
+        std::fill(classicOutput.begin(), classicOutput.end(), 0.0f);
+        std::fill(proc0Outputs[static_cast<size_t>(channel)].begin(), proc0Outputs[static_cast<size_t>(channel)].end(), 0.0f);
+        std::fill(proc1Outputs[static_cast<size_t>(channel)].begin(), proc1Outputs[static_cast<size_t>(channel)].end(), 0.0f);
 
         // === CLASSIC MODE PROCESSING ===
         // Eventide-style Hilbert frequency shifter with precision-filtered feedback
         // Uses IIR allpass Hilbert transform with DC blocking + 4th order LPF for clean cascading
         if (useClassicMode || switching)
         {
-            auto& hilbert = hilbertShifters[static_cast<size_t>(channel)];
+            auto& hilbert = state.hilbertShifter;
             hilbert.setShiftHz(currentShiftHz);
 
-            for (int i = 0; i < numSamples; ++i)
+            auto& lines = state.getLines<SampleType>();
+            auto& fbBuffer = lines.feedbackBuffer;
+            const bool readFeedback = currentDelayEnabled && currentFeedbackAmount > 0.01f;
+            const bool writeFeedback = currentDelayEnabled && !switching;
+
+            // Classic mode: NO FFT latency compensation - use raw delay time
+            int delaySamples = static_cast<int>(modulatedDelayTimeMs * currentSampleRate / 1000.0f);
+
+            // Ensure minimum delay of ~10ms to prevent artifacts
+            int minDelaySamples = static_cast<int>(10.0f * currentSampleRate / 1000.0f);
+            delaySamples = std::clamp(delaySamples, minDelaySamples, fbBuffer.getCapacity() - 1);
+
+            // The stages run chunk by chunk, each chunk no longer than the feedback delay,
+            // so every sample read back was written by an earlier chunk and each stage is
+            // one timed loop. Within a chunk, read offsets account for the unwritten samples.
+            const int chunkSize = currentDelayEnabled ? std::max(1, delaySamples) : numSamples;
+            for (int chunkStart = 0; chunkStart < numSamples; chunkStart += chunkSize)
             {
-                float inputSample = drySignal[static_cast<size_t>(i)];
+                const int chunkEnd = std::min(numSamples, chunkStart + chunkSize);
 
                 // Add feedback from delay buffer for cascading/cumulative pitch shifts (barber-pole effect)
-                if (currentDelayEnabled && currentFeedbackAmount > 0.01f)
+                if (readFeedback)
                 {
-                    auto& fbBuffer = feedbackBuffers[static_cast<size_t>(channel)];
-                    int fbBufSize = static_cast<int>(fbBuffer.size());
-
-                    // Classic mode: NO FFT latency compensation - use raw delay time
-                    int delaySamples = static_cast<int>(modulatedDelayTimeMs * currentSampleRate / 1000.0f);
-
-                    // Ensure minimum delay of ~10ms to prevent artifacts
-                    int minDelaySamples = static_cast<int>(10.0f * currentSampleRate / 1000.0f);
-                    delaySamples = std::clamp(delaySamples, minDelaySamples, fbBufSize - 1);
+                    FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::Feedback);
+                    for (int i = chunkStart; i < chunkEnd; ++i)
+                    {
+                        // Read from own channel feedback buffer
+                        const int pending = writeFeedback ? i - chunkStart : 0;
+                        SampleType feedbackSample = fbBuffer.getDelayed(delaySamples - pending) * currentFeedbackAmount;
 
-                    // Read from own channel feedback buffer
-                    int fbReadPos = (feedbackWritePos[static_cast<size_t>(channel)] - delaySamples + fbBufSize) % fbBufSize;
-                    float feedbackSample = fbBuffer[static_cast<size_t>(fbReadPos)] * currentFeedbackAmount;
+                        // Soft clip feedback on read for safety
+                        if (std::abs(feedbackSample) > 0.95f)
+                        {
+                            feedbackSample = std::tanh(feedbackSample);
+                        }
 
-                    // Soft clip feedback on read for safety
-                    if (std::abs(feedbackSample) > 0.95f)
-                    {
-                        feedbackSample = std::tanh(feedbackSample);
+                        classicOutput[static_cast<size_t>(i)] = static_cast<float>(drySignal[static_cast<size_t>(i)] + feedbackSample);
                     }
-
-                    inputSample += feedbackSample;
+                }
+                else
+                {
+                    const auto& input = engineInput(channel);
+                    std::copy(input.begin() + chunkStart, input.begin() + chunkEnd, classicOutput.begin() + chunkStart);
                 }
 
-                // Apply Hilbert transform frequency shift (feedback goes through for cumulative shifts)
-                float shiftedSample = hilbert.process(inputSample, channel);
+                // Apply Hilbert transform frequency shift (feedback goes through for cumulative shifts).
+                // Output is the shifted signal (feedback creates cascading barber-pole effect)
+                {
+                    FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::ClassicHilbert);
+                    for (int i = chunkStart; i < chunkEnd; ++i)
+                        classicOutput[static_cast<size_t>(i)] = hilbert.process(classicOutput[static_cast<size_t>(i)], channel);
+                }
 
                 // === EVENTIDE-STYLE FEEDBACK FILTERING ===
                 // Write to feedback buffer with precision filtering to clean up sideband leakage
-                if (currentDelayEnabled && !switching)
+                if (writeFeedback)
                 {
-                    auto& fbBuffer = feedbackBuffers[static_cast<size_t>(channel)];
-                    int fbBufSize = static_cast<int>(fbBuffer.size());
-
-                    float toBuffer = shiftedSample;
-
-                    // 1. DC Blocker (1st order HPF at ~10Hz)
-                    // Removes DC offset that accumulates from imperfect sideband cancellation
-                    float& dcState = classicDcBlockState[static_cast<size_t>(channel)];
-                    float dcBlocked = toBuffer - dcState;
-                    dcState += dcBlocked * 0.0005f;  // ~10Hz at 44.1kHz (1 - 0.9995)
-                    toBuffer = dcBlocked;
-
-                    // 2. Steep Anti-aliasing LPF (4th order Butterworth at 12kHz)
-                    // Suppresses high-frequency artifacts from sideband leakage
-                    auto& lpfState = classicFbLpfState[static_cast<size_t>(channel)];
-
-                    // First biquad section
-                    float x0 = toBuffer;
-                    float x1 = lpfState[0];
-                    float x2 = lpfState[1];
-                    float y1 = lpfState[2];
-                    float y2 = lpfState[3];
-
-                    float filtered1 = classicFbLpfCoeffs[0] * x0
-                                    + classicFbLpfCoeffs[1] * x1
-                                    + classicFbLpfCoeffs[2] * x2
-                                    + classicFbLpfCoeffs[3] * y1
-                                    + classicFbLpfCoeffs[4] * y2;
-
-                    lpfState[0] = x0;
-                    lpfState[1] = x1;
-                    lpfState[2] = filtered1;
-                    lpfState[3] = y1;
-
-                    // Second biquad section (cascaded for 4th order)
-                    x0 = filtered1;
-                    x1 = lpfState[4];
-                    x2 = lpfState[5];
-                    y1 = lpfState[6];
-                    y2 = lpfState[7];
-
-                    float filtered2 = classicFbLpfCoeffs[5] * x0
-                                    + classicFbLpfCoeffs[6] * x1
-                                    + classicFbLpfCoeffs[7] * x2
-                                    + classicFbLpfCoeffs[8] * y1
-                                    + classicFbLpfCoeffs[9] * y2;
-
-                    lpfState[4] = x0;
-                    lpfState[5] = x1;
-                    lpfState[6] = filtered2;
-                    lpfState[7] = y1;
-
-                    toBuffer = filtered2;
-
-                    // 3. Soft limiter to prevent runaway
-                    if (std::abs(toBuffer) > 0.95f)
-                        toBuffer = std::tanh(toBuffer);
-
-                    // Write to feedback buffer
-                    fbBuffer[static_cast<size_t>(feedbackWritePos[static_cast<size_t>(channel)])] = toBuffer;
-                    feedbackWritePos[static_cast<size_t>(channel)] = (feedbackWritePos[static_cast<size_t>(channel)] + 1) % fbBufSize;
-                }
+                    FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::Feedback);
+                    SampleType& dcState = lines.classicDcBlockState;
+                    auto& lpfState = lines.classicFbLpfState;
+                    SampleType writtenPeak = 0;
 
-                // Output is the shifted signal (feedback creates cascading barber-pole effect)
-                classicOutput[static_cast<size_t>(i)] = shiftedSample;
+                    for (int i = chunkStart; i < chunkEnd; ++i)
+                    {
+                        SampleType toBuffer = classicOutput[static_cast<size_t>(i)];
+
+                        // 1. DC Blocker (1st order HPF at ~10Hz)
+                        // Removes DC offset that accumulates from imperfect sideband cancellation
+                        SampleType dcBlocked = toBuffer - dcState;
+                        dcState += dcBlocked * 0.0005f;  // ~10Hz at 44.1kHz (1 - 0.9995)
+                        toBuffer = dcBlocked;
+
+                        // 2. Steep Anti-aliasing LPF (4th order Butterworth at 12kHz)
+                        // Suppresses high-frequency artifacts from sideband leakage
+
+                        // First biquad section
+                        SampleType x0 = toBuffer;
+                        SampleType x1 = lpfState[0];
+                        SampleType x2 = lpfState[1];
+                        SampleType y1 = lpfState[2];
+                        SampleType y2 = lpfState[3];
+
+                        SampleType filtered1 = classicFbLpfCoeffs[0] * x0
+                                        + classicFbLpfCoeffs[1] * x1
+                                        + classicFbLpfCoeffs[2] * x2
+                                        + classicFbLpfCoeffs[3] * y1
+                                        + classicFbLpfCoeffs[4] * y2;
+
+                        lpfState[0] = x0;
+                        lpfState[1] = x1;
+                        lpfState[2] = filtered1;
+                        lpfState[3] = y1;
+
+                        // Second biquad section (cascaded for 4th order)
+                        x0 = filtered1;
+                        x1 = lpfState[4];
+                        x2 = lpfState[5];
+                        y1 = lpfState[6];
+                        y2 = lpfState[7];
+
+                        SampleType filtered2 = classicFbLpfCoeffs[5] * x0
+                                        + classicFbLpfCoeffs[6] * x1
+                                        + classicFbLpfCoeffs[7] * x2
+                                        + classicFbLpfCoeffs[8] * y1
+                                        + classicFbLpfCoeffs[9] * y2;
+
+                        lpfState[4] = x0;
+                        lpfState[5] = x1;
+                        lpfState[6] = filtered2;
+                        lpfState[7] = y1;
+
+                        toBuffer = filtered2;
+
+                        // 3. Soft limiter to prevent runaway
+                        if (std::abs(toBuffer) > 0.95f)
+                            toBuffer = std::tanh(toBuffer);
+
+                        // Write to feedback buffer
+                        fbBuffer.push(toBuffer);
+                        writtenPeak = std::max(writtenPeak, std::abs(toBuffer));
+                    }
+                    state.noteFeedbackWrite(writtenPeak, chunkEnd - chunkStart);
+                }
             }
         }
+    }
 
-        // === SPECTRAL MODE PROCESSING ===
-        // Process through both STFT pipelines (or just one if singleProc)
-        if (useSpectralMode || switching)
+    // === SPECTRAL MODE PROCESSING ===
+    // Process through both STFT pipelines (or just one if singleProc)
+    if (spectralEngineSuspended)
+    {
+        for (int channel = 0; channel < numProcessedChannels; ++channel)
         {
+            const auto& drySignal = engineInput(channel);
+            // Keep the analysis history current so resuming only needs the OLA warm-up
             const int numProcs = singleProc ? 1 : 2;
+            auto& state = channelStates[static_cast<size_t>(channel)];
+            if (bandSplitActive)
+            {
+                // Both bands keep being analysed (the crossover runs, the STFTs do not)
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    float highSample = 0.0f;
+                    float lowSample = 0.0f;
+                    if (state.bandSplitter.split(drySignal[static_cast<size_t>(i)], highSample, lowSample))
+                    {
+                        state.inputBuffers[1].push(lowSample);
+                        state.hopPhases[1] = (state.hopPhases[1] + 1) % currentHopSizes[1];
+                    }
+                    state.inputBuffers[0].push(highSample);
+                }
+                state.hopPhases[0] = (state.hopPhases[0] + numSamples) % currentHopSizes[0];
+            }
+            else
+            {
+                for (int proc = 0; proc < numProcs; ++proc)
+                {
+                    auto& inputBuf = state.inputBuffers[proc];
+                    if (inputBuf.isEmpty())
+                        continue;
+
+                    inputBuf.write(drySignal.data(), numSamples);
+                    auto& hopPhase = state.hopPhases[static_cast<size_t>(proc)];
+                    hopPhase = (hopPhase + numSamples) % currentHopSizes[proc];
+                }
+            }
+        }
+    }
+    else if (useSpectralMode || switching)
+    {
+        const int numProcs = singleProc ? 1 : 2;
+
+        // STFT frames are split into analysis and synthesis so that STEREO LINK can run both
+        // channels' forward transforms for a hop before either channel's frame is synthesized
+
+        // Analysis: extract the frame and run the forward STFT into the channel's pending frame
+        auto analyzeFrame = [&](int channel, int proc)
+        {
+            const int fftSize = currentFftSizes[proc];
+            auto& inputBuf = channelStates[channel].inputBuffers[proc];
+            auto& frame = pendingFrames[static_cast<size_t>(channel)][static_cast<size_t>(proc)];
+
+            blockTiming.setFlag(fshift::BlockTimingMonitor::FftFrame);
 
-            for (int proc = 0; proc < numProcs; ++proc)
+            // Input frame, read in place (the ring mirrors one frame, so it is contiguous)
+            const float* inputFrame = nullptr;
             {
-                if (!stftProcessors[channel][proc])
-                    continue;
+                FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::FrameExtract);
+                inputFrame = inputBuf.getWindow(fftSize);
+            }
+
+            // Perform STFT
+            {
+                FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::StftForward);
+                std::tie(frame.magnitude, frame.phase) = stftProcessors[channel][proc]->forward(inputFrame, fftSize);
+            }
+            frame.due = true;
+        };
 
+        // Synthesis: spectral processing of the pending frame, inverse STFT and overlap-add.
+        // sharedPeaks is the STEREO LINK peak set for this hop (nullptr when not linked).
+        auto finishFrame = [&](int channel, int proc, const std::vector<bool>* sharedPeaks)
+        {
             const int fftSize = currentFftSizes[proc];
-            const int hopSize = currentHopSizes[proc];
-            auto& inputBuf = inputBuffers[channel][proc];
-            auto& outputBuf = outputBuffers[channel][proc];
-            auto& inWritePos = inputWritePos[channel][proc];
-            auto& outReadPos = outputReadPos[channel][proc];
-            auto& procOutput = (proc == 0) ? proc0Output : proc1Output;
-
-            // Process through STFT pipeline
-            for (int i = 0; i < numSamples; ++i)
+            const double procSampleRate = processorSampleRates[proc];
+            auto& outputBuf = channelStates[channel].outputBuffers[proc];
+            auto& frame = pendingFrames[static_cast<size_t>(channel)][static_cast<size_t>(proc)];
+            auto& magnitude = frame.magnitude;
+            auto& phase = frame.phase;
+            frame.due = false;
+
+            // BAND SPLIT low band: own quantizer, and the mask/delay tables (built for the
+            // full-rate spectrum) are read over the first 1/BAND_SPLIT_FACTOR of their range
+            const bool lowBand = bandSplitActive && proc == 1;
+            auto* procQuantizer = lowBand ? lowBandQuantizer.get() : quantizer.get();
+            const int tableDecimation = lowBand ? BAND_SPLIT_FACTOR : 1;
+
+            if (!bypassProcessing)
             {
-                // Start with dry input sample
-                float inputSample = drySignal[static_cast<size_t>(i)];
+                // Save dry spectrum for mask blending
+                std::vector<float> dryMagnitude;
+                std::vector<float> dryPhase;
+                if (currentMaskEnabled)
+                {
+                    dryMagnitude = magnitude;
+                    dryPhase = phase;
+                }
 
-                // Add feedback from time-domain buffer (only once per sample, on proc 0)
-                // This routes feedback BEFORE the shifter for cascading pitch shifts
-                if (currentDelayEnabled && proc == 0)
+                // Phase 2B: Capture spectral envelope from INPUT before any processing
+                // This is crucial for accurate timbre preservation
+                std::vector<float> inputEnvelope;
+                const std::vector<float>* envelopePtr = nullptr;
+                float currentPreserve = preserveAmount.load();
+                if (currentPreserve > 0.01f && procQuantizer && currentQuantizeStrength > 0.01f)
+                {
+                    inputEnvelope = procQuantizer->getSpectralEnvelope(magnitude, procSampleRate, fftSize);
+                    envelopePtr = &inputEnvelope;
+                }
+
+                // Apply phase vocoder if enabled
+                if (currentUsePhaseVocoder && std::abs(currentShiftHz) > 0.01f)
                 {
-                    auto& fbBuffer = feedbackBuffers[static_cast<size_t>(channel)];
-                    int fbBufSize = static_cast<int>(fbBuffer.size());
-
-                    // Calculate delay in samples from TIME parameter
-                    // IMPORTANT: Compensate for SMEAR-dependent FFT latency!
-                    // The feedback path goes through FFT processing, which adds latency
-                    // that varies with SMEAR setting. We subtract this to keep delay
-                    // timing consistent regardless of SMEAR.
-                    //
-                    // FFT latency is approximately fftSize samples (input buffering + output overlap)
-                    // We use the primary processor's FFT size (proc 0) since that's where
-                    // feedback is injected.
-                    int currentFftLatencySamples = currentFftSizes[0];  // SMEAR-dependent latency
-
-                    int rawDelaySamples = static_cast<int>(modulatedDelayTimeMs * currentSampleRate / 1000.0f);
-                    int delaySamples = rawDelaySamples - currentFftLatencySamples;
-
-                    // Ensure minimum delay of ~10ms to prevent artifacts
-                    int minDelaySamples = static_cast<int>(10.0f * currentSampleRate / 1000.0f);
-                    delaySamples = std::clamp(delaySamples, minDelaySamples, fbBufSize - 1);
-
-                    // Read from feedback buffer and add to input for cascading pitch shifts
-                    int fbReadPos = (feedbackWritePos[static_cast<size_t>(channel)] - delaySamples + fbBufSize) % fbBufSize;
-                    float delayedSample = fbBuffer[static_cast<size_t>(fbReadPos)];
-                    float feedbackSample = delayedSample * currentFeedbackAmount;
-
-                    // Soft clip feedback for safety (tanh-style)
-                    if (std::abs(feedbackSample) > 0.95f)
+                    FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::PhaseVocoder);
+                    auto& stft = *stftProcessors[channel][proc];
+                    auto& vocoder = *phaseVocoders[channel][proc];
+                    if (stft.isReassignmentEnabled())
                     {
-                        feedbackSample = std::tanh(feedbackSample);
+                        phase = vocoder.process(magnitude, phase, stft.getReassignedFrequencies(), currentShiftHz);
                     }
-
-                    inputSample += feedbackSample;
-
-                    // DEBUG: Log feedback activity (once per second per channel)
-                    static int debugCounter = 0;
-                    if (channel == 0 && ++debugCounter % static_cast<int>(currentSampleRate) == 0)
+                    else if (sharedPeaks != nullptr)
+                    {
+                        // STEREO LINK: peaks were detected on this hop's max(L, R)
+                        phase = vocoder.process(magnitude, phase, currentShiftHz, *sharedPeaks);
+                    }
+                    else
                     {
-                        DBG("=== Delay Feedback Debug ===");
-                        DBG("Delayed sample: " + juce::String(delayedSample, 6));
-                        DBG("Input after feedback: " + juce::String(inputSample, 6));
-                        DBG("Requested delay: " + juce::String(modulatedDelayTimeMs) + " ms (base: " + juce::String(currentDelayTimeMs) + " ms)");
-                        DBG("FFT latency compensation: " + juce::String(currentFftLatencySamples) + " samples ("
-                            + juce::String(currentFftLatencySamples * 1000.0f / currentSampleRate, 1) + " ms)");
-                        DBG("Raw delay samples: " + juce::String(rawDelaySamples));
-                        DBG("Compensated delay samples: " + juce::String(delaySamples));
-                        DBG("Feedback amount: " + juce::String(currentFeedbackAmount * 100.0f) + "%");
+                        phase = vocoder.process(magnitude, phase, currentShiftHz);
                     }
                 }
 
-                // Write input sample (with feedback) to circular buffer
-                inputBuf[static_cast<size_t>(inWritePos)] = inputSample;
-                inWritePos = (inWritePos + 1) % static_cast<int>(inputBuf.size());
+                // Apply frequency shifting
+                if (std::abs(currentShiftHz) > 0.01f)
+                {
+                    FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::Shift);
+                    std::tie(magnitude, phase) = frequencyShifters[channel][proc]->shift(magnitude, phase, currentShiftHz);
+                }
 
-                // Check if we have enough samples for an FFT frame
-                if (inWritePos % hopSize == 0)
+                // Apply musical quantization
+                // Note: LFO now modulates base shift Hz instead of per-bin drift
+                if (currentQuantizeStrength > 0.01f && procQuantizer)
                 {
-                    // Get input frame
-                    std::vector<float> inputFrame(static_cast<size_t>(fftSize));
-                    int readPos = (inWritePos - fftSize + static_cast<int>(inputBuf.size()))
-                                  % static_cast<int>(inputBuf.size());
-                    for (int j = 0; j < fftSize; ++j)
+                    FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::Quantize);
+                    // Pass the pre-shift envelope for accurate timbre preservation
+                    std::tie(magnitude, phase) = procQuantizer->quantizeSpectrum(
+                        magnitude, phase, procSampleRate, fftSize, currentQuantizeStrength, nullptr, envelopePtr);
+
+                    // Publish the per-note energy the quantizer already computed
+                    // (BAND SPLIT: the low band's notes are merged into the next high band frame)
+                    if (channel == 0 && lowBand)
                     {
-                        inputFrame[static_cast<size_t>(j)] = inputBuf[static_cast<size_t>((readPos + j) % static_cast<int>(inputBuf.size()))];
+                        lowBandNoteMagnitudes = procQuantizer->getNoteMagnitudes();
                     }
-
-                    // Perform STFT
-                    auto [magnitude, phase] = stftProcessors[channel][proc]->forward(inputFrame);
-
-                    if (!bypassProcessing)
+                    else if (channel == 0 && proc == 0)
                     {
-                        // Save dry spectrum for mask blending
-                        std::vector<float> dryMagnitude;
-                        std::vector<float> dryPhase;
-                        if (currentMaskEnabled)
+                        auto& notes = noteActivityBuffer.getWriteBuffer();
+                        notes = procQuantizer->getNoteMagnitudes();
+                        if (bandSplitActive)
                         {
-                            dryMagnitude = magnitude;
-                            dryPhase = phase;
+                            for (size_t note = 0; note < notes.size(); ++note)
+                                notes[note] = std::max(notes[note], lowBandNoteMagnitudes[note]);
                         }
+                        noteActivityBuffer.publish();
+                    }
+                }
 
-                        // Phase 2B: Capture spectral envelope from INPUT before any processing
-                        // This is crucial for accurate timbre preservation
-                        std::vector<float> inputEnvelope;
-                        const std::vector<float>* envelopePtr = nullptr;
-                        float currentPreserve = preserveAmount.load();
-                        if (currentPreserve > 0.01f && quantizer && currentQuantizeStrength > 0.01f)
-                        {
-                            inputEnvelope = quantizer->getSpectralEnvelope(magnitude, currentSampleRate, fftSize);
-                            envelopePtr = &inputEnvelope;
-                        }
+                // Apply spectral mask (blend wet/dry per frequency bin)
+                if (currentMaskEnabled && maskCurve != nullptr && !dryMagnitude.empty())
+                {
+                    FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::Mask);
+                    fshift::SpectralMask::applyMask(*maskCurve, magnitude, dryMagnitude, tableDecimation);
+                    fshift::SpectralMask::applyMaskToPhase(*maskCurve, phase, dryPhase, tableDecimation);
+                }
 
-                        // Apply phase vocoder if enabled
-                        if (currentUsePhaseVocoder && std::abs(currentShiftHz) > 0.01f)
-                        {
-                            phase = phaseVocoders[channel][proc]->process(magnitude, phase, currentShiftHz);
-                        }
+                // Apply spectral delay (frequency-dependent delay)
+                if (currentDelayEnabled && delayCurves != nullptr)
+                {
+                    FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::SpectralDelay);
+                    // Update spectral delay with tempo-synced time (if sync enabled)
+                    channelStates[channel].spectralDelays[proc].setDelayTime(modulatedDelayTimeMs);
+                    channelStates[channel].spectralDelays[proc].process(magnitude, phase, *delayCurves, tableDecimation);
+                }
+            }
 
-                        // Apply frequency shifting
-                        if (std::abs(currentShiftHz) > 0.01f)
-                        {
-                            std::tie(magnitude, phase) = frequencyShifters[channel][proc]->shift(magnitude, phase, currentShiftHz);
-                        }
+            // Store spectrum data for visualization (only from first channel, first processor;
+            // a BAND SPLIT low band frame is kept and overlaid on the next high band frame)
+            if (channel == 0 && lowBand)
+            {
+                std::copy_n(magnitude.begin(), std::min(magnitude.size(), lowBandSpectrum.size()), lowBandSpectrum.begin());
+            }
+            else if (channel == 0 && proc == 0)
+            {
+                publishSpectrum(magnitude);
+            }
 
-                        // Apply musical quantization
-                        // Note: LFO now modulates base shift Hz instead of per-bin drift
-                        if (currentQuantizeStrength > 0.01f && quantizer)
-                        {
-                            // Pass the pre-shift envelope for accurate timbre preservation
-                            std::tie(magnitude, phase) = quantizer->quantizeSpectrum(
-                                magnitude, phase, currentSampleRate, fftSize, currentQuantizeStrength, nullptr, envelopePtr);
-                        }
+            // Perform inverse STFT
+            std::vector<float> outputFrame;
+            {
+                FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::StftInverse);
+                outputFrame = stftProcessors[channel][proc]->inverse(magnitude, phase);
+            }
 
-                        // Apply spectral mask (blend wet/dry per frequency bin)
-                        if (currentMaskEnabled && !dryMagnitude.empty())
-                        {
-                            spectralMask.applyMask(magnitude, dryMagnitude);
-                            spectralMask.applyMaskToPhase(phase, dryPhase);
-                        }
+            // Overlap-add to output buffer, starting at the current read position.
+            // Only the non-zero synthesis region is added, so an asymmetric frame's
+            // tail lands synthesisOffset samples earlier (lower latency).
+            FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::OverlapAdd);
+            const int synthesisOffset = stftProcessors[channel][proc]->getSynthesisOffset();
+            outputBuf.addFrom(0, outputFrame.data() + synthesisOffset, fftSize - synthesisOffset);
+        };
+
+        // === Time-domain feedback (processor 0 only) ===
+        // Calculate delay in samples from TIME parameter
+        // IMPORTANT: Compensate for SMEAR-dependent FFT latency!
+        // The feedback path goes through FFT processing, which adds latency
+        // that varies with SMEAR setting. We subtract this to keep delay
+        // timing consistent regardless of SMEAR.
+        //
+        // FFT latency is the STFT frame latency (fftSize, or the synthesis window
+        // length in LOW LATENCY). We use the primary processor (proc 0) since that's
+        // where feedback is injected.
+        const int currentFftLatencySamples = currentFrameLatencies[0];  // SMEAR-dependent latency
+
+        const int rawDelaySamples = static_cast<int>(modulatedDelayTimeMs * currentSampleRate / 1000.0f);
+        int feedbackDelaySamples = rawDelaySamples - currentFftLatencySamples;
+
+        // Ensure minimum delay of ~10ms to prevent artifacts
+        const int minDelaySamples = static_cast<int>(10.0f * currentSampleRate / 1000.0f);
+        feedbackDelaySamples = std::clamp(feedbackDelaySamples, minDelaySamples,
+                                          channelStates[0].getFeedbackCapacity() - 1);
+
+        // Processor 0's input for the block: dry plus feedback
+        std::array<std::span<float>, MAX_CHANNELS> feedbackInputs;
+        for (int channel = 0; channel < numProcessedChannels; ++channel)
+            feedbackInputs[static_cast<size_t>(channel)] = channelStates[static_cast<size_t>(channel)].feedbackInput.first(
+                static_cast<size_t>(numSamples));
+
+        // Add feedback from time-domain buffer for [chunkStart, chunkEnd), before the shifter for
+        // cascading pitch shifts. The chunk's own output is not written yet, so reads step back.
+        auto readFeedback = [&](int channel, int chunkStart, int chunkEnd)
+        {
+            auto& fbBuffer = channelStates[static_cast<size_t>(channel)].getLines<SampleType>().feedbackBuffer;
+            const auto& drySignal = drySignals[static_cast<size_t>(channel)];
+            auto& input = feedbackInputs[static_cast<size_t>(channel)];
 
-                        // Apply spectral delay (frequency-dependent delay)
-                        if (currentDelayEnabled)
-                        {
-                            // Update spectral delay with tempo-synced time (if sync enabled)
-                            spectralDelays[channel][proc].setDelayTime(modulatedDelayTimeMs);
-                            spectralDelays[channel][proc].process(magnitude, phase);
-                        }
-                    }
+            for (int i = chunkStart; i < chunkEnd; ++i)
+            {
+                // Read from feedback buffer and add to input for cascading pitch shifts
+                SampleType delayedSample = fbBuffer.getDelayed(feedbackDelaySamples - (i - chunkStart));
+                SampleType feedbackSample = delayedSample * currentFeedbackAmount;
 
-                    // Store spectrum data for visualization (only from first channel, first processor)
-                    if (channel == 0 && proc == 0)
-                    {
-                        const juce::SpinLock::ScopedLockType lock(spectrumLock);
-                        const int numBins = std::min(static_cast<int>(magnitude.size()), SPECTRUM_SIZE);
-                        for (int bin = 0; bin < numBins; ++bin)
-                        {
-                            // Convert to dB with smoothing
-                            float magDb = juce::Decibels::gainToDecibels(magnitude[static_cast<size_t>(bin)], -100.0f);
-                            // Normalize to 0-1 range (-100dB to 0dB)
-                            float normalized = (magDb + 100.0f) / 100.0f;
-                            spectrumData[static_cast<size_t>(bin)] = std::max(0.0f, std::min(1.0f, normalized));
-                        }
-                        spectrumDataReady.store(true);
-                    }
+                // Soft clip feedback for safety (tanh-style)
+                if (std::abs(feedbackSample) > 0.95f)
+                {
+                    feedbackSample = std::tanh(feedbackSample);
+                }
 
-                    // Perform inverse STFT
-                    auto outputFrame = stftProcessors[channel][proc]->inverse(magnitude, phase);
+                float inputSample = static_cast<float>(drySignal[static_cast<size_t>(i)] + feedbackSample);
+                input[static_cast<size_t>(i)] = inputSample;
 
-                    // Overlap-add to output buffer
-                    int writePos = (outReadPos + i) % static_cast<int>(outputBuf.size());
-                    for (int j = 0; j < fftSize; ++j)
+                // DEBUG: Log feedback activity (once per second per channel)
+                static int debugCounter = 0;
+                if (channel == 0 && ++debugCounter % static_cast<int>(currentSampleRate) == 0)
+                {
+                    DBG("=== Delay Feedback Debug ===");
+                    DBG("Delayed sample: " + juce::String(delayedSample, 6));
+                    DBG("Input after feedback: " + juce::String(inputSample, 6));
+                    DBG("Requested delay: " + juce::String(modulatedDelayTimeMs) + " ms (base: " + juce::String(currentDelayTimeMs) + " ms)");
+                    DBG("FFT latency compensation: " + juce::String(currentFftLatencySamples) + " samples ("
+                        + juce::String(currentFftLatencySamples * 1000.0f / currentSampleRate, 1) + " ms)");
+                    DBG("Raw delay samples: " + juce::String(rawDelaySamples));
+                    DBG("Compensated delay samples: " + juce::String(feedbackDelaySamples));
+                    DBG("Feedback amount: " + juce::String(currentFeedbackAmount * 100.0f) + "%");
+                }
+            }
+        };
+
+        // Write processor 0's output for [chunkStart, chunkEnd) to the time-domain feedback buffer.
+        // This gets added to input on the next delay cycle, creating cascading pitch shifts
+        auto writeFeedback = [&](int channel, int chunkStart, int chunkEnd)
+        {
+            auto& state = channelStates[static_cast<size_t>(channel)];
+            auto& lines = state.getLines<SampleType>();
+            auto& fbBuffer = lines.feedbackBuffer;
+            auto& hpfState = lines.feedbackHpfState;
+            SampleType& lpfState = lines.feedbackFilterState;
+            const auto& output = proc0Outputs[static_cast<size_t>(channel)];
+            SampleType writtenPeak = 0;
+
+            for (int i = chunkStart; i < chunkEnd; ++i)
+            {
+                const SampleType outputSample = output[static_cast<size_t>(i)];
+
+                // === Feedback signal chain: HPF (150Hz) → LPF (DAMP) → Write ===
+
+                // Step 1: Apply highpass filter (150Hz) to prevent low frequency buildup
+                // Biquad Direct Form I: y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+                SampleType x0 = outputSample;
+                SampleType x1 = hpfState[0];
+                SampleType x2 = hpfState[1];
+                SampleType y1 = hpfState[2];
+                SampleType y2 = hpfState[3];
+
+                SampleType hpfOutput = feedbackHpfCoeffs[0] * x0
+                                + feedbackHpfCoeffs[1] * x1
+                                + feedbackHpfCoeffs[2] * x2
+                                + feedbackHpfCoeffs[3] * y1  // Note: coeffs already negated
+                                + feedbackHpfCoeffs[4] * y2;
+
+                // Update HPF state
+                hpfState[1] = x1;  // x[n-2] = x[n-1]
+                hpfState[0] = x0;  // x[n-1] = x[n]
+                hpfState[3] = y1;  // y[n-2] = y[n-1]
+                hpfState[2] = hpfOutput;  // y[n-1] = y[n]
+
+                // Step 2: Apply damping filter (one-pole lowpass) to feedback
+                lpfState = hpfOutput + feedbackFilterCoeff * (lpfState - hpfOutput);
+
+                // Write to feedback buffer
+                fbBuffer.push(lpfState);
+                writtenPeak = std::max(writtenPeak, std::abs(lpfState));
+
+                // DEBUG: Log output being written to feedback buffer (once per second)
+                static int fbWriteDebugCounter = 0;
+                if (channel == 0 && ++fbWriteDebugCounter % static_cast<int>(currentSampleRate) == 0)
+                {
+                    DBG("--- Feedback Write ---");
+                    DBG("Output sample (raw): " + juce::String(outputSample, 6));
+                    DBG("After HPF: " + juce::String(hpfOutput, 6));
+                    DBG("After LPF (written to buffer): " + juce::String(lpfState, 6));
+                }
+            }
+            state.noteFeedbackWrite(writtenPeak, chunkEnd - chunkStart);
+        };
+
+        // Per-sample input side: BAND SPLIT crossover, STFT input and hop check.
+        // A decimated low band sample is left queued in lowSampleQueued for endSample.
+        std::array<bool, MAX_CHANNELS> lowSampleQueued{};
+        std::array<bool, NUM_PROCESSORS> peaksLinked{};  // linkedPeaks holds this sample's hop
+        auto beginSample = [&](int channel, int proc, int i)
+        {
+            // Start with dry input sample (processor 0 takes it with the feedback added)
+            const auto& input = currentDelayEnabled && proc == 0 ? feedbackInputs[static_cast<size_t>(channel)]
+                                                                  : engineInput(channel);
+            float inputSample = input[static_cast<size_t>(i)];
+
+            // BAND SPLIT: the high band continues below; every BAND_SPLIT_FACTOR samples a
+            // low band sample goes into processor 1, whose output is recombined in endSample
+            auto& state = channelStates[channel];
+            if (bandSplitActive && proc == 0)
+            {
+                float lowSample = 0.0f;
+                lowSampleQueued[static_cast<size_t>(channel)] = state.bandSplitter.split(inputSample, inputSample, lowSample);
+                if (lowSampleQueued[static_cast<size_t>(channel)])
+                {
+                    auto& lowHopPhase = state.hopPhases[1];
+                    state.inputBuffers[1].push(lowSample);
+                    if (++lowHopPhase >= currentHopSizes[1])
                     {
-                        int pos = (writePos + j) % static_cast<int>(outputBuf.size());
-                        outputBuf[static_cast<size_t>(pos)] += outputFrame[static_cast<size_t>(j)];
+                        lowHopPhase = 0;
+                        analyzeFrame(channel, 1);
                     }
                 }
+            }
+
+            // Write input sample (with feedback) to circular buffer
+            state.inputBuffers[proc].push(inputSample);
+
+            // Check if we have enough samples for an FFT frame
+            int& hopPhase = state.hopPhases[static_cast<size_t>(proc)];
+            if (++hopPhase >= currentHopSizes[proc])
+            {
+                hopPhase = 0;
+                analyzeFrame(channel, proc);
+            }
+        };
+
+        // Per-sample output side: synthesize due frames, overlap-add read and BAND SPLIT
+        // recombination
+        auto endSample = [&](int channel, int proc, int i)
+        {
+            auto& state = channelStates[channel];
+            auto finishIfDue = [&](int frameProc)
+            {
+                if (pendingFrames[static_cast<size_t>(channel)][static_cast<size_t>(frameProc)].due)
+                    finishFrame(channel, frameProc, peaksLinked[static_cast<size_t>(frameProc)] ? &linkedPeaks[static_cast<size_t>(frameProc)] : nullptr);
+            };
+
+            const bool splitBands = bandSplitActive && proc == 0;
+            if (splitBands && lowSampleQueued[static_cast<size_t>(channel)])
+            {
+                finishIfDue(1);
+                state.bandSplitter.pushLow(state.outputBuffers[1].popAndClear());
+            }
+            finishIfDue(proc);
 
-                // Read from output buffer
-                float outputSample = outputBuf[static_cast<size_t>(outReadPos)];
-                outputBuf[static_cast<size_t>(outReadPos)] = 0.0f;  // Clear for next overlap-add
-                outReadPos = (outReadPos + 1) % static_cast<int>(outputBuf.size());
+            // Read from output buffer (cleared for next overlap-add)
+            float outputSample = state.outputBuffers[proc].popAndClear();
 
-                // Write processed output to time-domain feedback buffer (only once, on proc 0)
-                // This gets added to input on the next delay cycle, creating cascading pitch shifts
-                if (currentDelayEnabled && proc == 0)
+            // BAND SPLIT: add the interpolated low band, aligned with the high band
+            if (splitBands)
+                outputSample = state.bandSplitter.combine(outputSample);
+
+            auto& procOutput = (proc == 0) ? proc0Outputs[static_cast<size_t>(channel)] : proc1Outputs[static_cast<size_t>(channel)];
+            procOutput[static_cast<size_t>(i)] = outputSample;
+        };
+
+        // STEREO LINK peaks for a processor's hop, once both channels' frames are pending
+        const bool linkPhaseLocking = currentUsePhaseVocoder && std::abs(currentShiftHz) > 0.01f;
+        auto linkPeaks = [&](int frameProc)
+        {
+            const auto p = static_cast<size_t>(frameProc);
+            auto& vocoder = *phaseVocoders[0][frameProc];
+            peaksLinked[p] = false;
+            if (!linkPhaseLocking || !pendingFrames[0][p].due || !pendingFrames[1][p].due
+                || !vocoder.getUsePhaseLocking() || stftProcessors[0][frameProc]->isReassignmentEnabled())
+                return;
+
+            const auto& left = pendingFrames[0][p].magnitude;
+            const auto& right = pendingFrames[1][p].magnitude;
+            auto& combined = linkedMagnitude[p];
+            for (size_t bin = 0; bin < combined.size(); ++bin)
+                combined[bin] = std::max(left[bin], right[bin]);
+            vocoder.detectPeaks(combined, linkedPeaks[p]);
+            peaksLinked[p] = true;
+        };
+
+        // Feedback and the STFT stages run chunk by chunk, each chunk no longer than the
+        // feedback delay, so every sample read back was written by an earlier chunk
+        const int chunkSize = currentDelayEnabled ? std::max(1, feedbackDelaySamples) : numSamples;
+        for (int chunkStart = 0; chunkStart < numSamples; chunkStart += chunkSize)
+        {
+            const int chunkEnd = std::min(numSamples, chunkStart + chunkSize);
+
+            if (currentDelayEnabled)
+            {
+                FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::Feedback);
+                for (int channel = 0; channel < numProcessedChannels; ++channel)
+                    readFeedback(channel, chunkStart, chunkEnd);
+            }
+
+            if (linkStereoPeaks)
+            {
+                // STEREO LINK: both channels analyse the hop, peaks are detected once on the
+                // hop's max(L, R), then both channels synthesize it with the shared peak set
+                for (int proc = 0; proc < numProcs; ++proc)
+                {
+                    if (!stftProcessors[0][proc] || !stftProcessors[1][proc])
+                        continue;
+
+                    const int lowProc = bandSplitActive && proc == 0 ? 1 : proc;
+                    for (int i = chunkStart; i < chunkEnd; ++i)
+                    {
+                        beginSample(0, proc, i);
+                        beginSample(1, proc, i);
+
+                        if (lowProc != proc)
+                            linkPeaks(lowProc);
+                        linkPeaks(proc);
+
+                        endSample(0, proc, i);
+                        endSample(1, proc, i);
+                    }
+                }
+            }
+            else
+            {
+                for (int channel = 0; channel < numProcessedChannels; ++channel)
                 {
-                    auto& fbBuffer = feedbackBuffers[static_cast<size_t>(channel)];
-                    int fbBufSize = static_cast<int>(fbBuffer.size());
-
-                    // === Feedback signal chain: HPF (150Hz) → LPF (DAMP) → Write ===
-
-                    // Step 1: Apply highpass filter (150Hz) to prevent low frequency buildup
-                    // Biquad Direct Form I: y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
-                    auto& hpfState = feedbackHpfState[static_cast<size_t>(channel)];
-                    float x0 = outputSample;
-                    float x1 = hpfState[0];
-                    float x2 = hpfState[1];
-                    float y1 = hpfState[2];
-                    float y2 = hpfState[3];
-
-                    float hpfOutput = feedbackHpfCoeffs[0] * x0
-                                    + feedbackHpfCoeffs[1] * x1
-                                    + feedbackHpfCoeffs[2] * x2
-                                    + feedbackHpfCoeffs[3] * y1  // Note: coeffs already negated
-                                    + feedbackHpfCoeffs[4] * y2;
-
-                    // Update HPF state
-                    hpfState[1] = x1;  // x[n-2] = x[n-1]
-                    hpfState[0] = x0;  // x[n-1] = x[n]
-                    hpfState[3] = y1;  // y[n-2] = y[n-1]
-                    hpfState[2] = hpfOutput;  // y[n-1] = y[n]
-
-                    // Step 2: Apply damping filter (one-pole lowpass) to feedback
-                    float& lpfState = feedbackFilterState[static_cast<size_t>(channel)];
-                    lpfState = hpfOutput + feedbackFilterCoeff * (lpfState - hpfOutput);
-
-                    // Write to feedback buffer
-                    fbBuffer[static_cast<size_t>(feedbackWritePos[static_cast<size_t>(channel)])] = lpfState;
-                    feedbackWritePos[static_cast<size_t>(channel)] = (feedbackWritePos[static_cast<size_t>(channel)] + 1) % fbBufSize;
-
-                    // DEBUG: Log output being written to feedback buffer (once per second)
-                    static int fbWriteDebugCounter = 0;
-                    if (channel == 0 && ++fbWriteDebugCounter % static_cast<int>(currentSampleRate) == 0)
+                    for (int proc = 0; proc < numProcs; ++proc)
                     {
-                        DBG("--- Feedback Write ---");
-                        DBG("Output sample (raw): " + juce::String(outputSample, 6));
-                        DBG("After HPF: " + juce::String(hpfOutput, 6));
-                        DBG("After LPF (written to buffer): " + juce::String(filteredSample, 6));
+                        if (!stftProcessors[channel][proc])
+                            continue;
+
+                        for (int i = chunkStart; i < chunkEnd; ++i)
+                        {
+                            beginSample(channel, proc, i);
+                            endSample(channel, proc, i);
+                        }
                     }
                 }
+            }
 
-                procOutput[static_cast<size_t>(i)] = outputSample;
+            if (currentDelayEnabled)
+            {
+                FSHIFT_PROFILE_SCOPE(stageProfiler, fshift::ProfileStage::Feedback);
+                for (int channel = 0; channel < numProcessedChannels; ++channel)
+                    writeFeedback(channel, chunkStart, chunkEnd);
             }
         }
-        } // End of Spectral mode processing
+    } // End of Spectral mode processing
 
-        // === MIXING AND OUTPUT ===
-        // Handle both Classic and Spectral modes, with crossfade during mode switching
+    // === MIXING AND OUTPUT ===
+    // Handle both Classic and Spectral modes, with crossfade during mode switching
+    for (int channel = 0; channel < numProcessedChannels; ++channel)
+    {
+        auto* channelData = buffer.getWritePointer(channel);
+        const auto& drySignal = drySignals[static_cast<size_t>(channel)];
+        auto& lines = channelStates[static_cast<size_t>(channel)].getLines<SampleType>();
+        const auto& classicOutput = classicOutputs[static_cast<size_t>(channel)];
+        const auto& proc0Output = proc0Outputs[static_cast<size_t>(channel)];
+        const auto& proc1Output = proc1Outputs[static_cast<size_t>(channel)];
 
         // FFT size crossfade gains (for Spectral mode dual-processor blending)
         const float fftAngle = crossfade * static_cast<float>(M_PI) * 0.5f;
@@ -1683,8 +2766,8 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
 
         for (int i = 0; i < numSamples; ++i)
         {
-            float wetSample = 0.0f;
-            float drySample = drySignal[static_cast<size_t>(i)];
+            SampleType wetSample = 0;
+            SampleType drySample = drySignal[static_cast<size_t>(i)];
 
             if (currentMode == 0 && !switching)
             {
@@ -1695,8 +2778,8 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
                 // Apply WARM filter (vintage bandwidth limiting) to wet signal
                 if (currentWarmEnabled)
                 {
-                    auto& warmState = warmFilterState[static_cast<size_t>(channel)];
-                    float wx0 = wetSample;
+                    auto& warmState = channelStates[static_cast<size_t>(channel)].warmFilterState;
+                    float wx0 = static_cast<float>(wetSample);
                     float wx1 = warmState[0];
                     float wx2 = warmState[1];
                     float wy1 = warmState[2];
@@ -1717,10 +2800,7 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
                 }
 
                 // Still write to dry delay buffer to keep it updated for potential mode switch
-                auto& dryBuf = dryDelayBuffers[channel];
-                int bufSize = static_cast<int>(dryBuf.size());
-                dryBuf[static_cast<size_t>(dryDelayWritePos[channel])] = drySample;
-                dryDelayWritePos[channel] = (dryDelayWritePos[channel] + 1) % bufSize;
+                lines.dryDelayBuffer.push(drySample);
 
                 // Mix dry/wet (no delay on dry for Classic mode)
                 channelData[i] = drySample * (1.0f - currentDryWet) + wetSample * currentDryWet;
@@ -1743,54 +2823,54 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
                 }
 
                 // Apply delay compensation to maintain fixed latency
-                int effectiveFftSize = singleProc ? currentFftSizes[0] :
-                    static_cast<int>(static_cast<float>(currentFftSizes[0]) * fftGain0 * fftGain0 +
-                                     static_cast<float>(currentFftSizes[1]) * fftGain1 * fftGain1);
-                int delayNeeded = MAX_FFT_SIZE - effectiveFftSize;
-
-                // Write to delay compensation buffer
-                delayCompBuffers[channel][static_cast<size_t>(delayCompWritePos[channel])] = spectralProcessed;
-                delayCompWritePos[channel] = (delayCompWritePos[channel] + 1) %
-                    static_cast<int>(delayCompBuffers[channel].size());
-
-                // Read from delay compensation buffer
-                int readIdx = (delayCompWritePos[channel] - delayNeeded - 1 +
-                    static_cast<int>(delayCompBuffers[channel].size())) %
-                    static_cast<int>(delayCompBuffers[channel].size());
-                wetSample = delayCompBuffers[channel][static_cast<size_t>(readIdx)];
-
-                // Delay dry signal by MAX_FFT_SIZE to align with wet
-                auto& dryBuf = dryDelayBuffers[channel];
-                int bufSize = static_cast<int>(dryBuf.size());
-                dryBuf[static_cast<size_t>(dryDelayWritePos[channel])] = drySample;
-                int dryReadIdx = (dryDelayWritePos[channel] - MAX_FFT_SIZE + bufSize) % bufSize;
-                float delayedDrySample = dryBuf[static_cast<size_t>(dryReadIdx)];
-                dryDelayWritePos[channel] = (dryDelayWritePos[channel] + 1) % bufSize;
+                int effectiveFftSize = singleProc ? currentFrameLatencies[0] :
+                    static_cast<int>(static_cast<float>(currentFrameLatencies[0]) * fftGain0 * fftGain0 +
+                                     static_cast<float>(currentFrameLatencies[1]) * fftGain1 * fftGain1);
+                // The OLA output trails by one sample less than the frame latency, so at least
+                // one sample is always needed (LOW LATENCY and max SMEAR included)
+                const int delayNeeded = fshift::latency::getCompensationDelay(spectralLatency, effectiveFftSize);
+
+                // Write to delay compensation buffer, then read delayNeeded samples back
+                lines.delayCompBuffer.push(spectralProcessed);
+                wetSample = lines.delayCompBuffer.getDelayed(fshift::latency::getTapAfterPush(delayNeeded));
+
+                // Delay dry signal by the Spectral latency to align with wet
+                auto& dryBuf = lines.dryDelayBuffer;
+                dryBuf.push(drySample);
+                SampleType delayedDrySample = dryBuf.getDelayed(fshift::latency::getTapAfterPush(spectralLatency));
+
+                // TRUE BYPASS: linear crossfade (signals are correlated) to the aligned dry line
+                if (applyBypassBlend)
+                {
+                    float bypassGain = bypassGainStart + (bypassGainEnd - bypassGainStart)
+                        * static_cast<float>(i) / static_cast<float>(numSamples);
+                    wetSample += bypassGain * (delayedDrySample - wetSample);
+                }
 
                 // Phase 2B+ Amplitude envelope tracking (Spectral only)
                 float currentPreserve = preserveAmount.load();
                 if (currentPreserve > 0.01f && !bypassProcessing)
                 {
-                    float inputAbs = std::abs(delayedDrySample);
-                    if (inputAbs > inputEnvelope[static_cast<size_t>(channel)])
-                        inputEnvelope[static_cast<size_t>(channel)] =
-                            inputAbs + envAttackCoeff * (inputEnvelope[static_cast<size_t>(channel)] - inputAbs);
+                    float inputAbs = static_cast<float>(std::abs(delayedDrySample));
+                    if (inputAbs > channelStates[static_cast<size_t>(channel)].inputEnvelope)
+                        channelStates[static_cast<size_t>(channel)].inputEnvelope =
+                            inputAbs + envAttackCoeff * (channelStates[static_cast<size_t>(channel)].inputEnvelope - inputAbs);
                     else
-                        inputEnvelope[static_cast<size_t>(channel)] =
-                            inputAbs + envReleaseCoeff * (inputEnvelope[static_cast<size_t>(channel)] - inputAbs);
+                        channelStates[static_cast<size_t>(channel)].inputEnvelope =
+                            inputAbs + envReleaseCoeff * (channelStates[static_cast<size_t>(channel)].inputEnvelope - inputAbs);
 
-                    float outputAbs = std::abs(wetSample);
-                    if (outputAbs > outputEnvelope[static_cast<size_t>(channel)])
-                        outputEnvelope[static_cast<size_t>(channel)] =
-                            outputAbs + envAttackCoeff * (outputEnvelope[static_cast<size_t>(channel)] - outputAbs);
+                    float outputAbs = static_cast<float>(std::abs(wetSample));
+                    if (outputAbs > channelStates[static_cast<size_t>(channel)].outputEnvelope)
+                        channelStates[static_cast<size_t>(channel)].outputEnvelope =
+                            outputAbs + envAttackCoeff * (channelStates[static_cast<size_t>(channel)].outputEnvelope - outputAbs);
                     else
-                        outputEnvelope[static_cast<size_t>(channel)] =
-                            outputAbs + envReleaseCoeff * (outputEnvelope[static_cast<size_t>(channel)] - outputAbs);
+                        channelStates[static_cast<size_t>(channel)].outputEnvelope =
+                            outputAbs + envReleaseCoeff * (channelStates[static_cast<size_t>(channel)].outputEnvelope - outputAbs);
 
                     float effectiveStrength = std::pow(currentPreserve, 0.7f);
                     constexpr float epsilon = 1e-6f;
-                    float gainCorrection = inputEnvelope[static_cast<size_t>(channel)] /
-                                           (outputEnvelope[static_cast<size_t>(channel)] + epsilon);
+                    float gainCorrection = channelStates[static_cast<size_t>(channel)].inputEnvelope /
+                                           (channelStates[static_cast<size_t>(channel)].outputEnvelope + epsilon);
                     gainCorrection = std::clamp(gainCorrection, 0.25f, 4.0f);
                     float blendedCorrection = 1.0f + effectiveStrength * (gainCorrection - 1.0f);
                     wetSample *= blendedCorrection;
@@ -1799,8 +2879,8 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
                 // Apply WARM filter (vintage bandwidth limiting) to wet signal
                 if (currentWarmEnabled)
                 {
-                    auto& warmState = warmFilterState[static_cast<size_t>(channel)];
-                    float wx0 = wetSample;
+                    auto& warmState = channelStates[static_cast<size_t>(channel)].warmFilterState;
+                    float wx0 = static_cast<float>(wetSample);
                     float wx1 = warmState[0];
                     float wx2 = warmState[1];
                     float wy1 = warmState[2];
@@ -1840,27 +2920,26 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
                                         proc1Output[static_cast<size_t>(i)] * fftGain1;
                 }
 
-                int effectiveFftSize = singleProc ? currentFftSizes[0] :
-                    static_cast<int>(static_cast<float>(currentFftSizes[0]) * fftGain0 * fftGain0 +
-                                     static_cast<float>(currentFftSizes[1]) * fftGain1 * fftGain1);
-                int delayNeeded = MAX_FFT_SIZE - effectiveFftSize;
+                int effectiveFftSize = singleProc ? currentFrameLatencies[0] :
+                    static_cast<int>(static_cast<float>(currentFrameLatencies[0]) * fftGain0 * fftGain0 +
+                                     static_cast<float>(currentFrameLatencies[1]) * fftGain1 * fftGain1);
+                const int delayNeeded = fshift::latency::getCompensationDelay(spectralLatency, effectiveFftSize);
 
-                delayCompBuffers[channel][static_cast<size_t>(delayCompWritePos[channel])] = spectralProcessed;
-                delayCompWritePos[channel] = (delayCompWritePos[channel] + 1) %
-                    static_cast<int>(delayCompBuffers[channel].size());
-
-                int readIdx = (delayCompWritePos[channel] - delayNeeded - 1 +
-                    static_cast<int>(delayCompBuffers[channel].size())) %
-                    static_cast<int>(delayCompBuffers[channel].size());
-                float spectralWet = delayCompBuffers[channel][static_cast<size_t>(readIdx)];
+                lines.delayCompBuffer.push(spectralProcessed);
+                SampleType spectralWet = lines.delayCompBuffer.getDelayed(fshift::latency::getTapAfterPush(delayNeeded));
 
                 // Handle dry signal delay buffer
-                auto& dryBuf = dryDelayBuffers[channel];
-                int bufSize = static_cast<int>(dryBuf.size());
-                dryBuf[static_cast<size_t>(dryDelayWritePos[channel])] = drySample;
-                int dryReadIdx = (dryDelayWritePos[channel] - MAX_FFT_SIZE + bufSize) % bufSize;
-                float delayedDrySample = dryBuf[static_cast<size_t>(dryReadIdx)];
-                dryDelayWritePos[channel] = (dryDelayWritePos[channel] + 1) % bufSize;
+                auto& dryBuf = lines.dryDelayBuffer;
+                dryBuf.push(drySample);
+                SampleType delayedDrySample = dryBuf.getDelayed(fshift::latency::getTapAfterPush(spectralLatency));
+
+                // Still warming up after TRUE BYPASS: use the aligned dry line for Spectral
+                if (applyBypassBlend)
+                {
+                    float bypassGain = bypassGainStart + (bypassGainEnd - bypassGainStart)
+                        * static_cast<float>(i) / static_cast<float>(numSamples);
+                    spectralWet += bypassGain * (delayedDrySample - spectralWet);
+                }
 
                 // Mode crossfade (equal-power)
                 float progress = modeCrossfadeProgress + modeCrossfadeRate * static_cast<float>(i);
@@ -1869,8 +2948,8 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
                 float fromGain = std::cos(modeAngle);
                 float toGain = std::sin(modeAngle);
 
-                float finalWet;
-                float finalDry;
+                SampleType finalWet;
+                SampleType finalDry;
                 if (targetMode == 0)
                 {
                     // Switching TO Classic (FROM Spectral)
@@ -1889,8 +2968,8 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
                 // Apply WARM filter (vintage bandwidth limiting) to wet signal
                 if (currentWarmEnabled)
                 {
-                    auto& warmState = warmFilterState[static_cast<size_t>(channel)];
-                    float wx0 = finalWet;
+                    auto& warmState = channelStates[static_cast<size_t>(channel)].warmFilterState;
+                    float wx0 = static_cast<float>(finalWet);
                     float wx1 = warmState[0];
                     float wx2 = warmState[1];
                     float wy1 = warmState[2];
@@ -1921,28 +3000,153 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
         }
     }
 
+    if (monoFastPathActive)
+    {
+        buffer.copyFrom(1, 0, buffer, 0, 0, numSamples);
+    }
+    else if (inputChannelsMatch)
+    {
+        // Only count blocks whose outputs also match, so both channels' tails agree
+        // before the right channel stops being processed
+        if (channelsMatch(buffer.getReadPointer(0), buffer.getReadPointer(1), numSamples))
+            ++monoMatchBlocks;
+        else
+            monoMatchBlocks = 0;
+    }
+
     // Apply stereo decorrelation if enabled (0.06ms delay on left channel only)
     // This reduces phase-locked resonance artifacts between L/R channels
     if (stereoDecorrelateEnabled.load() && numChannels >= 2 && decorrelateDelaySamples > 0)
     {
         auto* leftChannel = buffer.getWritePointer(0);
-        int bufSize = static_cast<int>(leftDecorrelateBuffer.size());
 
         for (int i = 0; i < numSamples; ++i)
         {
             // Read delayed sample from buffer
-            int readPos = (decorrelateWritePos - decorrelateDelaySamples + bufSize) % bufSize;
-            float delayedSample = leftDecorrelateBuffer[static_cast<size_t>(readPos)];
+            float delayedSample = leftDecorrelateBuffer.getDelayed(decorrelateDelaySamples);
 
             // Write current sample to buffer
-            leftDecorrelateBuffer[static_cast<size_t>(decorrelateWritePos)] = leftChannel[i];
-            decorrelateWritePos = (decorrelateWritePos + 1) % bufSize;
+            leftDecorrelateBuffer.push(static_cast<float>(leftChannel[i]));
 
             // Output delayed sample
             leftChannel[i] = delayedSample;
         }
     }
 
+    // Count consecutive silent samples (input and output) towards suspension
+    if (inputSilent && buffer.getMagnitude(0, numSamples) < SILENCE_THRESHOLD)
+        silentSampleCount = std::min(silentSampleCount + numSamples, std::numeric_limits<int>::max() / 2);
+    else
+        silentSampleCount = 0;
+
+    advanceDriftLfo(numSamples);
+}
+
+void FrequencyShifterProcessor::TableBuilderThread::run()
+{
+    while (!threadShouldExit())
+    {
+        owner.rebuildDerivedTables();
+        owner.stageSpectralDelayLines();
+        owner.stageDspObjects();
+        wait(20);
+    }
+}
+
+void FrequencyShifterProcessor::rebuildDerivedTables()
+{
+    const std::lock_guard<std::mutex> lock(tableBuildMutex);
+
+    if (!tablesNeedRebuild.exchange(false))
+        return;
+
+    // Tables are built at TABLE_FFT_SIZE resolution; every FFT size samples them with an integer stride
+    tableMaskBuilder.setMode(static_cast<fshift::SpectralMask::Mode>(maskMode.load()));
+    tableMaskBuilder.setLowFreq(maskLowFreq.load());
+    tableMaskBuilder.setHighFreq(maskHighFreq.load());
+    tableMaskBuilder.setTransition(maskTransition.load());
+    tableMaskBuilder.computeMaskCurve(tableSampleRate.load(), TABLE_FFT_SIZE);
+    maskTables.publish(tableMaskBuilder.getMaskCurve());
+
+    delayTables.publish(fshift::SpectralDelay::buildTables(delaySlope.load(), delayDamping.load(),
+                                                           TABLE_FFT_SIZE / 2));
+}
+
+template <typename SampleType>
+bool FrequencyShifterProcessor::channelsMatch(const SampleType* left, const SampleType* right, int numSamples)
+{
+    // Early exit keeps this cheap for genuinely stereo material
+    for (int i = 0; i < numSamples; ++i)
+    {
+        if (std::abs(left[i] - right[i]) > MONO_MATCH_TOLERANCE)
+            return false;
+    }
+    return true;
+}
+
+void FrequencyShifterProcessor::syncChannelState(int src, int dst)
+{
+    // Copy-assign in place: buffers already have matching sizes, so no allocation
+    for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
+    {
+        if (phaseVocoders[src][proc] && phaseVocoders[dst][proc])
+            *phaseVocoders[dst][proc] = *phaseVocoders[src][proc];
+    }
+
+    // Live history: one STFT frame, the Spectral latency, and the longest delay the
+    // TIME setting plus delay LFO depth can read (nothing while DELAY is off)
+    ChannelState::LiveLengths live;
+    for (int proc = 0; proc < NUM_PROCESSORS; ++proc)
+        live.frame[static_cast<size_t>(proc)] = currentFftSizes[proc];
+    live.latency = getSpectralLatencySamples() + 1;
+    if (delayEnabled.load())
+    {
+        live.spectralDelayMs = std::min(2000.0f, delayTime.load() + dlyLfoDepth.load());
+        live.feedback = static_cast<int>(std::ceil(live.spectralDelayMs * 0.001 * currentSampleRate)) + 1;
+    }
+
+    channelStates[static_cast<size_t>(dst)].copyStateFrom(channelStates[static_cast<size_t>(src)], live);
+}
+
+void FrequencyShifterProcessor::ChannelState::copyStateFrom(const ChannelState& other, const LiveLengths& live)
+{
+    for (size_t proc = 0; proc < static_cast<size_t>(NUM_PROCESSORS); ++proc)
+    {
+        inputBuffers[proc].copyRecentFrom(other.inputBuffers[proc], live.frame[proc]);
+        outputBuffers[proc].copyStateFrom(other.outputBuffers[proc]);
+        hopPhases[proc] = other.hopPhases[proc];
+        spectralDelays[proc].copyStateFrom(other.spectralDelays[proc], live.spectralDelayMs);
+    }
+
+    // Only the set laid out for the processing precision holds anything
+    auto copyLines = [&live](auto& lines, const auto& otherLines)
+    {
+        if (lines.feedbackBuffer.isEmpty())
+            return;
+        lines.delayCompBuffer.copyRecentFrom(otherLines.delayCompBuffer, live.latency);
+        lines.dryDelayBuffer.copyRecentFrom(otherLines.dryDelayBuffer, live.latency);
+        lines.feedbackBuffer.copyRecentFrom(otherLines.feedbackBuffer, live.feedback);
+        lines.feedbackFilterState = otherLines.feedbackFilterState;
+        lines.feedbackHpfState = otherLines.feedbackHpfState;
+        lines.classicDcBlockState = otherLines.classicDcBlockState;
+        lines.classicFbLpfState = otherLines.classicFbLpfState;
+    };
+    copyLines(floatLines, other.floatLines);
+    copyLines(doubleLines, other.doubleLines);
+    feedbackSilentRun = std::min(other.feedbackSilentRun, live.feedback);  // Older slots were not copied
+
+    inputEnvelope = other.inputEnvelope;
+    outputEnvelope = other.outputEnvelope;
+    warmFilterState = other.warmFilterState;
+    feedbackLpf1State = other.feedbackLpf1State;
+    feedbackLpf2State = other.feedbackLpf2State;
+    crossFeedbackSample = other.crossFeedbackSample;
+    hilbertShifter = other.hilbertShifter;
+    bandSplitter.copyStateFrom(other.bandSplitter);
+}
+
+void FrequencyShifterProcessor::advanceDriftLfo(int numSamples)
+{
     // Advance drift LFO phase for next block (Orville-style organic movement)
     // This creates slow ~0.2Hz modulation on Classic mode shift frequency
     driftLfoPhase += (DRIFT_LFO_RATE / currentSampleRate) * static_cast<double>(numSamples);
@@ -1950,18 +3154,100 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
         driftLfoPhase -= 1.0;
 }
 
+int FrequencyShifterProcessor::getSilenceTailSamples(bool delayOn, float delayTimeMs) const
+{
+    // OLA + latency tail (same as getTailLengthSeconds without feedback)
+    int tailSamples = MAX_FFT_SIZE + MAX_FFT_SIZE / 4 + BAND_SPLIT_LATENCY;
+
+    // Output must also stay silent for one full pass through the delay lines,
+    // otherwise recirculating feedback would have shown up in it. A pass is the
+    // feedback line plus the spectral delay, whose SLOPE stretches bins up to
+    // MAX_SLOPE_FACTOR times the delay time.
+    if (delayOn)
+    {
+        const float passMs = delayTimeMs * (1.0f + fshift::SpectralDelay::MAX_SLOPE_FACTOR);
+        tailSamples += static_cast<int>(passMs * 0.001f * static_cast<float>(currentSampleRate)) + MAX_FFT_SIZE;
+    }
+
+    return tailSamples;
+}
+
+bool FrequencyShifterProcessor::feedbackBuffersSilent() const
+{
+    // A line is silent once its whole length has been overwritten with silence
+    for (const auto& state : channelStates)
+    {
+        const int capacity = state.getFeedbackCapacity();
+        if (capacity > 0 && state.feedbackSilentRun < capacity)
+            return false;
+    }
+    return true;
+}
+
+void FrequencyShifterProcessor::clearDelayLines()
+{
+    for (auto& state : channelStates)
+    {
+        state.floatLines.feedbackBuffer.clear();
+        state.doubleLines.feedbackBuffer.clear();
+        state.feedbackSilentRun = state.getFeedbackCapacity();
+        for (auto& delay : state.spectralDelays)
+            delay.reset();
+    }
+}
+
+void FrequencyShifterProcessor::ChannelState::noteFeedbackWrite(double writtenPeak, int numWritten)
+{
+    // Conservative per chunk: any loud sample restarts the run at the chunk's end
+    feedbackSilentRun = writtenPeak < SILENCE_THRESHOLD
+        ? std::min(feedbackSilentRun + numWritten, getFeedbackCapacity())
+        : 0;
+}
+
 int FrequencyShifterProcessor::getLatencySamples() const
 {
     // Report latency based on processing mode
     // Classic mode: near-zero latency (~12 samples for allpass group delay)
-    // Spectral mode: full FFT latency (4096 samples)
-    return (processingMode.load() == 0) ? CLASSIC_MODE_LATENCY : MAX_FFT_SIZE;
+    // Spectral mode: full FFT latency (4096 samples, or half the FFT size in LOW LATENCY)
+    return reportedLatencySamples.load();
+}
+
+int FrequencyShifterProcessor::getSpectralLatencySamples() const
+{
+    // LOW LATENCY: the OLA pipeline delays by exactly one frame latency, so no padding needed.
+    // BAND SPLIT folds the crossover and both bands into processor 0's frame latency.
+    if (lowLatencyActive)
+        return bandSplitActive ? currentFrameLatencies[0] : std::max(currentFrameLatencies[0], currentFrameLatencies[1]);
+    return MAX_FFT_SIZE + (bandSplitActive ? BAND_SPLIT_LATENCY : 0);
+}
+
+void FrequencyShifterProcessor::requestLatencyUpdate(int latencySamples)
+{
+    // Safe to call from the audio thread: only an atomic store and a posted message
+    if (reportedLatencySamples.exchange(latencySamples) != latencySamples)
+        triggerAsyncUpdate();
+}
+
+void FrequencyShifterProcessor::handleAsyncUpdate()
+{
+    // Message thread: hosts expect latency changes here, never inside processBlock
+    setLatencySamples(reportedLatencySamples.load());
 }
 
 double FrequencyShifterProcessor::getTailLengthSeconds() const
 {
     // Latency from FFT processing (use max for consistency)
-    return static_cast<double>(MAX_FFT_SIZE + MAX_FFT_SIZE / 4) / currentSampleRate;
+    double tailSeconds = static_cast<double>(MAX_FFT_SIZE + MAX_FFT_SIZE / 4 + BAND_SPLIT_LATENCY) / currentSampleRate;
+
+    // Feedback delay: repeats until they fall below -100 dB (capped for hosts)
+    if (delayEnabled.load())
+    {
+        double feedback = std::clamp(static_cast<double>(delayFeedback.load()) / 100.0, 0.01, 0.95);
+        double repeats = std::ceil(std::log(SILENCE_THRESHOLD) / std::log(feedback));
+        tailSeconds += std::min(30.0, (repeats + 1.0) * static_cast<double>(delayTime.load()) / 1000.0);
+    }
+
+    return tailSeconds;
 }
 
 juce::AudioProcessorEditor* FrequencyShifterProcessor::createEditor()
@@ -1978,21 +3264,61 @@ void FrequencyShifterProcessor::getStateInformation(juce::MemoryBlock& destData)
 
 void FrequencyShifterProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
+    // Only the parameter tree is replaced here. The DSP is rebuilt from the polled
+    // values: by prepareToPlay if the host restores state first, otherwise once by
+    // the next processBlock, however many structural parameters the state changed.
+    const auto restoreStart = std::chrono::steady_clock::now();
+
     std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
     if (xmlState != nullptr && xmlState->hasTagName(parameters.state.getType()))
     {
         parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
     }
+
+    recordSetupTime(SETUP_SET_STATE, restoreStart);
+}
+
+void FrequencyShifterProcessor::publishSpectrum(const std::vector<float>& magnitude)
+{
+    // Audio thread: raw copy only, dB conversion happens in the editor
+    auto& frame = spectrumBuffer.getWriteBuffer();
+    const size_t numBins = std::min(magnitude.size(), frame.size());
+    std::copy_n(magnitude.begin(), numBins, frame.begin());
+    std::fill(frame.begin() + static_cast<std::ptrdiff_t>(numBins), frame.end(), 0.0f);
+
+    // BAND SPLIT: below the crossover the high band is empty; show the low band there instead.
+    // High bin b is at low bin b * factor * N1 / N0; magnitudes scale with FFT size.
+    if (bandSplitActive && !magnitude.empty() && !lowBandSpectrum.empty())
+    {
+        const int highFftSize = currentFftSizes[0];
+        const int lowFftSize = currentFftSizes[1];
+        const float gain = static_cast<float>(highFftSize) / static_cast<float>(lowFftSize);
+        const int crossoverBin = std::min(static_cast<int>(numBins), highFftSize / (4 * BAND_SPLIT_FACTOR));
+        for (int bin = 0; bin < crossoverBin; ++bin)
+        {
+            const size_t lowBin = static_cast<size_t>((bin * BAND_SPLIT_FACTOR * lowFftSize + highFftSize / 2) / highFftSize);
+            if (lowBin < lowBandSpectrum.size())
+                frame[static_cast<size_t>(bin)] = lowBandSpectrum[lowBin] * gain;
+        }
+    }
+    spectrumBuffer.publish();
+}
+
+bool FrequencyShifterProcessor::getNoteActivity(std::array<float, fshift::MusicalQuantizer::NUM_MIDI_NOTES>& data)
+{
+    if (!noteActivityBuffer.fetch())
+        return false;
+
+    data = noteActivityBuffer.getReadBuffer();
+    return true;
 }
 
 bool FrequencyShifterProcessor::getSpectrumData(std::array<float, SPECTRUM_SIZE>& data)
 {
-    if (!spectrumDataReady.load())
+    if (!spectrumBuffer.fetch())
         return false;
 
-    const juce::SpinLock::ScopedLockType lock(spectrumLock);
-    data = spectrumData;
-    spectrumDataReady.store(false);
+    data = spectrumBuffer.getReadBuffer();
     return true;
 }
 
@@ -8,6 +8,18 @@
 #include "dsp/SpectralMask.h"
 #include "dsp/SpectralDelay.h"
 #include "dsp/HilbertShifter.h"
+#include "dsp/BandSplitter.h"
+#include "dsp/StageProfiler.h"
+#include "dsp/BlockTimingMonitor.h"
+#include "dsp/TripleBuffer.h"
+#include "dsp/VersionedTable.h"
+#include "dsp/RingBuffer.h"
+#include "dsp/DspArena.h"
+#include "dsp/LatencyAlignment.h"
+#include <chrono>
+#include <mutex>
+#include <span>
+#include <type_traits>
 
 // Size of spectrum data for visualization (half of max FFT size)
 static constexpr int SPECTRUM_SIZE = 2048;
@@ -21,7 +33,7 @@ static constexpr int SPECTRUM_SIZE = 2048;
  * - Stereo processing support
  */
 class FrequencyShifterProcessor : public juce::AudioProcessor,
-                                   public juce::AudioProcessorValueTreeState::Listener
+                                   private juce::AsyncUpdater
 {
 public:
     FrequencyShifterProcessor();
@@ -34,6 +46,10 @@ public:
     bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
 
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock(juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+
+    // 64-bit hosts call the double overload directly instead of converting every block
+    bool supportsDoublePrecisionProcessing() const override { return true; }
 
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override { return true; }
@@ -54,9 +70,6 @@ public:
     void getStateInformation(juce::MemoryBlock& destData) override;
     void setStateInformation(const void* data, int sizeInBytes) override;
 
-    // Parameter listener
-    void parameterChanged(const juce::String& parameterID, float newValue) override;
-
     // Parameter tree
     juce::AudioProcessorValueTreeState& getValueTreeState() { return parameters; }
 
@@ -111,32 +124,203 @@ public:
     // WARM: Vintage bandwidth limiting (~10-12kHz rolloff on wet signal)
     static constexpr const char* PARAM_WARM = "warm";
 
-    // Valid FFT sizes for SMEAR control (at 44.1kHz)
-    // 256 (~6ms), 512 (~12ms), 1024 (~23ms), 2048 (~46ms), 4096 (~93ms)
-    static constexpr int FFT_SIZES[] = { 256, 512, 1024, 2048, 4096 };
-    static constexpr int NUM_FFT_SIZES = 5;
-    static constexpr int MAX_FFT_SIZE = 4096;  // Fixed latency reported to host for Spectral mode
+    // LOW LATENCY: Asymmetric STFT windows, report frame latency instead of padding to MAX_FFT_SIZE
+    static constexpr const char* PARAM_LOW_LATENCY = "lowLatency";
+
+    // STEREO LINK: Phase vocoder peak detection shared by both channels
+    static constexpr const char* PARAM_STEREO_LINK = "stereoLink";
+
+    // BAND SPLIT: Decimated low band with a long FFT, full-rate high band with the SMEAR FFT
+    static constexpr const char* PARAM_BAND_SPLIT = "bandSplit";
+
+    // OVERLAP: STFT overlap factor (hop = fftSize / factor)
+    static constexpr const char* PARAM_OVERLAP = "overlap";  // 0=Eco (2x), 1=Standard (4x), 2=HQ (8x)
+    static constexpr int OVERLAP_FACTORS[] = { 2, 4, 8 };
+
+    // Parameter registry: dense indices for the parameters polled each block
+    enum ParameterIndex
+    {
+        IDX_SHIFT_HZ,
+        IDX_QUANTIZE_STRENGTH,
+        IDX_ROOT_NOTE,
+        IDX_SCALE_TYPE,
+        IDX_DRY_WET,
+        IDX_PHASE_VOCODER,
+        IDX_SMEAR,
+        IDX_LFO_DEPTH,
+        IDX_LFO_DEPTH_MODE,
+        IDX_LFO_RATE,
+        IDX_LFO_SYNC,
+        IDX_LFO_DIVISION,
+        IDX_LFO_SHAPE,
+        IDX_DLY_LFO_DEPTH,
+        IDX_DLY_LFO_RATE,
+        IDX_DLY_LFO_SYNC,
+        IDX_DLY_LFO_DIVISION,
+        IDX_DLY_LFO_SHAPE,
+        IDX_MASK_ENABLED,
+        IDX_MASK_MODE,
+        IDX_MASK_LOW_FREQ,
+        IDX_MASK_HIGH_FREQ,
+        IDX_MASK_TRANSITION,
+        IDX_DELAY_ENABLED,
+        IDX_DELAY_TIME,
+        IDX_DELAY_SYNC,
+        IDX_DELAY_DIVISION,
+        IDX_DELAY_SLOPE,
+        IDX_DELAY_FEEDBACK,
+        IDX_DELAY_DAMPING,
+        IDX_DELAY_DIFFUSE,
+        IDX_DELAY_GAIN,
+        IDX_PRESERVE,
+        IDX_TRANSIENTS,
+        IDX_SENSITIVITY,
+        IDX_PROCESSING_MODE,
+        IDX_WARM,
+        IDX_LOW_LATENCY,
+        IDX_OVERLAP,
+        IDX_STEREO_LINK,
+        IDX_BAND_SPLIT,
+        NUM_PARAMETERS
+    };
+
+    static constexpr const char* PARAMETER_IDS[NUM_PARAMETERS] = {
+        PARAM_SHIFT_HZ,
+        PARAM_QUANTIZE_STRENGTH,
+        PARAM_ROOT_NOTE,
+        PARAM_SCALE_TYPE,
+        PARAM_DRY_WET,
+        PARAM_PHASE_VOCODER,
+        PARAM_SMEAR,
+        PARAM_LFO_DEPTH,
+        PARAM_LFO_DEPTH_MODE,
+        PARAM_LFO_RATE,
+        PARAM_LFO_SYNC,
+        PARAM_LFO_DIVISION,
+        PARAM_LFO_SHAPE,
+        PARAM_DLY_LFO_DEPTH,
+        PARAM_DLY_LFO_RATE,
+        PARAM_DLY_LFO_SYNC,
+        PARAM_DLY_LFO_DIVISION,
+        PARAM_DLY_LFO_SHAPE,
+        PARAM_MASK_ENABLED,
+        PARAM_MASK_MODE,
+        PARAM_MASK_LOW_FREQ,
+        PARAM_MASK_HIGH_FREQ,
+        PARAM_MASK_TRANSITION,
+        PARAM_DELAY_ENABLED,
+        PARAM_DELAY_TIME,
+        PARAM_DELAY_SYNC,
+        PARAM_DELAY_DIVISION,
+        PARAM_DELAY_SLOPE,
+        PARAM_DELAY_FEEDBACK,
+        PARAM_DELAY_DAMPING,
+        PARAM_DELAY_DIFFUSE,
+        PARAM_DELAY_GAIN,
+        PARAM_PRESERVE,
+        PARAM_TRANSIENTS,
+        PARAM_SENSITIVITY,
+        PARAM_PROCESSING_MODE,
+        PARAM_WARM,
+        PARAM_LOW_LATENCY,
+        PARAM_OVERLAP,
+        PARAM_STEREO_LINK,
+        PARAM_BAND_SPLIT,
+    };
+
+    // Valid FFT sizes for SMEAR control (at 44.1kHz): powers of two plus the 3/2 steps between them
+    // 256 (~6ms), 384 (~9ms), 512 (~12ms), 768 (~17ms), 1024 (~23ms), 1536 (~35ms),
+    // 2048 (~46ms), 3072 (~70ms), 4096 (~93ms)
+    static constexpr int FFT_SIZES[] = { 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096 };
+    static constexpr int NUM_FFT_SIZES = 9;
+    static constexpr int MAX_FFT_SIZE = 4096;  // Fixed latency reported to host for Spectral mode (unless LOW LATENCY)
+    // Mask/delay table resolution: a multiple of every FFT size, so each samples it with an integer stride
+    static constexpr int TABLE_FFT_SIZE = 3 * MAX_FFT_SIZE;
+    // BAND SPLIT: low band decimation and FFT size (same bin spacing as MAX_FFT_SIZE at the full rate)
+    static constexpr int BAND_SPLIT_FACTOR = 4;
+    static constexpr int BAND_SPLIT_LOW_FFT_SIZE = MAX_FFT_SIZE / BAND_SPLIT_FACTOR;
+    static constexpr int BAND_SPLIT_LATENCY = fshift::BandSplitter::getLatencySamples(BAND_SPLIT_FACTOR);
     static constexpr float MIN_SMEAR_MS = 5.0f;
     static constexpr float MAX_SMEAR_MS = 123.0f;
     static constexpr int CLASSIC_MODE_LATENCY = 12;  // ~0.3ms at 44.1kHz (allpass group delay)
 
-    // Get current latency in samples
+    // Get current latency in samples (last value published to the host)
     int getLatencySamples() const;
 
-    // Spectrum data access for visualization
-    // Returns true if new data is available
+    // Spectrum data access for visualization (linear bin magnitudes)
+    // Returns true if new data is available. Call from a single UI thread only.
     bool getSpectrumData(std::array<float, SPECTRUM_SIZE>& data);
+
+    // Quantizer note activity (linear energy per MIDI note, channel 0)
+    // Returns true if a new frame is available. Call from a single UI thread only.
+    bool getNoteActivity(std::array<float, fshift::MusicalQuantizer::NUM_MIDI_NOTES>& data);
+    int getRootNote() const { return static_cast<int>(rawParameterValues[IDX_ROOT_NOTE]->load()) + 60; }
+    int getScaleTypeIndex() const { return static_cast<int>(rawParameterValues[IDX_SCALE_TYPE]->load()); }
     double getSampleRate() const { return currentSampleRate; }
     int getCurrentFFTSize() const { return currentFftSizes[0]; }  // Primary FFT size for display
 
-    // Mask data access for visualization
-    const fshift::SpectralMask& getSpectralMask() const { return spectralMask; }
+    // Mask data access for visualization (copy of the latest published curve)
+    std::vector<float> getMaskCurve() const { return maskTables.getLatestCopy(); }
     bool isMaskEnabled() const { return maskEnabled.load(); }
 
     // Stereo decorrelation control (testing feature)
     void setStereoDecorrelate(bool enabled) { stereoDecorrelateEnabled.store(enabled); }
     bool getStereoDecorrelate() const { return stereoDecorrelateEnabled.load(); }
 
+    // Per-stage CPU profiling (timers are compiled in only with FSHIFT_PROFILING)
+    static constexpr bool isProfilingEnabled() { return FSHIFT_PROFILING != 0; }
+    fshift::StageProfiler& getStageProfiler() { return stageProfiler; }
+    const fshift::StageProfiler& getStageProfiler() const { return stageProfiler; }
+
+    // Always-on processBlock deadline tracking (histogram + worst blocks)
+    fshift::BlockTimingMonitor& getBlockTimingMonitor() { return blockTimingMonitor; }
+    const fshift::BlockTimingMonitor& getBlockTimingMonitor() const { return blockTimingMonitor; }
+
+    // Per-instance memory footprint by subsystem (refreshed whenever the DSP is rebuilt)
+    enum MemorySubsystem
+    {
+        MEM_RING_BUFFERS,       // Arena backing all circular buffers
+        MEM_CHANNEL_STATE,      // Inline per-channel filter/envelope state
+        MEM_STFT,
+        MEM_PHASE_VOCODER,
+        MEM_FREQUENCY_SHIFTER,
+        MEM_SPECTRAL_DELAY,
+        MEM_QUANTIZER,
+        MEM_SHARED_TABLES,      // Process-wide windows/twiddles/bin tables referenced (not owned)
+        NUM_MEMORY_SUBSYSTEMS
+    };
+    struct MemoryReport
+    {
+        std::array<size_t, NUM_MEMORY_SUBSYSTEMS> bytes{};
+        size_t getTotalBytes() const
+        {
+            size_t total = 0;
+            for (auto b : bytes)
+                total += b;
+            return total;
+        }
+    };
+    MemoryReport getMemoryReport() const;
+    static const char* getMemorySubsystemName(int subsystem);
+
+    // Wall time of the last construction / prepare / DSP rebuild / state restore,
+    // for benchmarking instantiation and session load
+    enum SetupStage
+    {
+        SETUP_CONSTRUCT,
+        SETUP_PREPARE,          // prepareToPlay, including its reinitializeDsp
+        SETUP_REINIT,
+        SETUP_SET_STATE,
+        NUM_SETUP_STAGES
+    };
+    struct SetupTimings
+    {
+        std::array<double, NUM_SETUP_STAGES> lastMicros{};
+        int numReinits = 0;     // Full DSP rebuilds since construction
+    };
+    SetupTimings getSetupTimings() const;
+    static const char* getSetupStageName(int stage);
+
 private:
     // Create parameter layout
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
@@ -144,6 +328,21 @@ private:
     // Process a single channel
     void processChannel(int channel, juce::AudioBuffer<float>& buffer);
 
+    // Shared body of both processBlock overloads. The dry path, delay compensation and
+    // feedback lines and filters run at the host's precision (ChannelState::SampleLines);
+    // the spectral engine and Classic shifter take float input (the Hilbert shifter keeps
+    // its own double state).
+    template <typename SampleType>
+    void processBlockImpl(juce::AudioBuffer<SampleType>& buffer);
+
+    // Runs processBlockImpl in pieces no longer than the prepared block size, which the
+    // per-block scratch in ChannelState is sized for (hosts may exceed it)
+    template <typename SampleType>
+    void processInPreparedBlocks(juce::AudioBuffer<SampleType>& buffer);
+
+    // Taken before any other member is built so SETUP_CONSTRUCT covers the parameter tree
+    const std::chrono::steady_clock::time_point constructionStart = std::chrono::steady_clock::now();
+
     // Parameter tree state
     juce::AudioProcessorValueTreeState parameters;
 
@@ -157,11 +356,48 @@ private:
     std::array<std::array<std::unique_ptr<fshift::PhaseVocoder>, NUM_PROCESSORS>, MAX_CHANNELS> phaseVocoders;
     std::array<std::array<std::unique_ptr<fshift::FrequencyShifter>, NUM_PROCESSORS>, MAX_CHANNELS> frequencyShifters;
     std::unique_ptr<fshift::MusicalQuantizer> quantizer;
-    fshift::SpectralMask spectralMask;
-    std::array<std::array<fshift::SpectralDelay, NUM_PROCESSORS>, MAX_CHANNELS> spectralDelays;
 
-    // Hilbert shifter for Classic mode (per channel)
-    std::array<fshift::HilbertShifter, MAX_CHANNELS> hilbertShifters;
+    // Lock-free per-stage CPU counters (written by the audio thread)
+    fshift::StageProfiler stageProfiler;
+
+    // Per-block wall time vs. deadline (written by the audio thread)
+    fshift::BlockTimingMonitor blockTimingMonitor;
+
+    // Derived tables (mask curve, delay slope/damping curves) are built off the
+    // audio thread and published as immutable versions. The audio thread acquires
+    // the latest version once per block and never computes or frees a table.
+    class TableBuilderThread : public juce::Thread
+    {
+    public:
+        explicit TableBuilderThread(FrequencyShifterProcessor& p)
+            : juce::Thread("FShift Table Builder"), owner(p) {}
+        void run() override;
+
+    private:
+        FrequencyShifterProcessor& owner;
+    };
+
+    void rebuildDerivedTables();
+    fshift::VersionedTable<std::vector<float>> maskTables;
+    fshift::VersionedTable<fshift::SpectralDelay::Tables> delayTables;
+    std::atomic<double> tableSampleRate{ 44100.0 };
+    std::atomic<bool> tablesNeedRebuild{ true };  // Set by the parameter poll
+    std::mutex tableBuildMutex;                   // Serializes builder thread and prepareToPlay
+    fshift::SpectralMask tableMaskBuilder;        // Owned by whoever holds tableBuildMutex
+    TableBuilderThread tableBuilderThread{ *this };
+
+    // Parameter registry state: APVTS raw values cached by index, polled once per
+    // block into a POD snapshot. Changed entries are applied on the audio thread,
+    // so DSP objects (quantizer, mask, delay) are never touched from the host thread.
+    struct ParameterSnapshot
+    {
+        std::array<float, NUM_PARAMETERS> values{};
+    };
+    std::array<std::atomic<float>*, NUM_PARAMETERS> rawParameterValues{};
+    ParameterSnapshot parameterSnapshot;
+    bool parameterSnapshotValid = false;
+    void pollParameters();
+    void applyParameterChange(int index, float newValue);
 
     // Processing parameters (atomic for thread safety)
     std::atomic<float> shiftHz{ 0.0f };
@@ -219,7 +455,6 @@ private:
     std::atomic<float> maskLowFreq{ 200.0f };
     std::atomic<float> maskHighFreq{ 5000.0f };
     std::atomic<float> maskTransition{ 1.0f };  // Octaves
-    std::atomic<bool> maskNeedsUpdate{ true };
     std::atomic<bool> delayEnabled{ false };
     std::atomic<float> delayTime{ 200.0f };
     std::atomic<bool> delaySync{ false };      // Tempo sync on/off
@@ -243,9 +478,50 @@ private:
     // WARM: Vintage bandwidth limiting
     std::atomic<bool> warmEnabled{ false };
 
+    // LOW LATENCY: Spectral latency follows the active frame latency (no padding to MAX_FFT_SIZE).
+    // Frames use asymmetric analysis/synthesis windows, so latency is a fraction of the FFT size.
+    std::atomic<bool> lowLatencyEnabled{ false };
+
+    // OVERLAP: index into OVERLAP_FACTORS (default Standard 4x)
+    std::atomic<int> overlapMode{ 1 };
+
+    // STEREO LINK: peaks are detected once per hop on max(L, R) magnitude and shared,
+    // so both channels get identical phase-locking regions. Both channels run the hop's
+    // forward STFT before either is synthesized, so the link uses the same hop from each.
+    std::atomic<bool> stereoLinkEnabled{ false };
+    std::array<std::vector<float>, NUM_PROCESSORS> linkedMagnitude;  // max(L, R) of the hop (sized in layoutBuffers)
+    std::array<std::vector<bool>, NUM_PROCESSORS> linkedPeaks;       // Peaks of linkedMagnitude
+
+    // An analysed STFT frame waiting for spectral processing and overlap-add
+    struct PendingFrame
+    {
+        std::vector<float> magnitude;
+        std::vector<float> phase;
+        bool due = false;
+    };
+    std::array<std::array<PendingFrame, NUM_PROCESSORS>, MAX_CHANNELS> pendingFrames;
+
+    // BAND SPLIT: the crossover decimates the low band by BAND_SPLIT_FACTOR. Processor 0 runs
+    // the high band at the full rate with the SMEAR FFT; processor 1 runs the low band with
+    // BAND_SPLIT_LOW_FFT_SIZE at the reduced rate, i.e. MAX_FFT_SIZE resolution for ~1/16 the cost.
+    std::atomic<bool> bandSplitEnabled{ false };
+    bool bandSplitActive = false;                    // Geometry in use (set by reinitializeDsp)
+    bool lowLatencyActive = false;                   // Likewise for LOW LATENCY
+    std::unique_ptr<fshift::MusicalQuantizer> lowBandQuantizer;  // Low band bins and rate
+    std::vector<float> lowBandSpectrum;              // Channel 0's latest low band frame (visualization)
+    std::array<float, fshift::MusicalQuantizer::NUM_MIDI_NOTES> lowBandNoteMagnitudes{};
+
+    // Latency published to the host. The audio thread only stores the new value;
+    // setLatencySamples() runs on the message thread in handleAsyncUpdate().
+    std::atomic<int> reportedLatencySamples{ MAX_FFT_SIZE };
+    void requestLatencyUpdate(int latencySamples);
+    void handleAsyncUpdate() override;
+
+    // Latency of the Spectral path for the current FFT size and LOW LATENCY setting
+    int getSpectralLatencySamples() const;
+
     // WARM lowpass filter state (2-pole Butterworth ~10-12kHz)
     // Applied to wet signal only, before feedback path for "melting" effect
-    std::array<std::array<float, 4>, MAX_CHANNELS> warmFilterState{};  // [x1, x2, y1, y2] per channel
     std::array<float, 5> warmFilterCoeffs{};  // Biquad coefficients [b0, b1, b2, a1, a2]
 
     // Mode switching crossfade state
@@ -255,18 +531,44 @@ private:
     int previousMode = 1;  // Mode we're switching from
     static constexpr float MODE_CROSSFADE_MS = 15.0f;  // 15ms crossfade duration
 
+    // TRUE BYPASS: when the Spectral engine would be an identity transform (no shift,
+    // LFO, quantize or feedback), skip STFT/OLA entirely and output the dry signal
+    // through the latency-matched dry delay line
+    float spectralBypassGain = 0.0f;       // 0 = engine output, 1 = latency-matched dry
+    bool spectralEngineSuspended = false;  // True while STFT frames are skipped
+    int spectralWarmupSamples = 0;         // Samples until OLA output is valid after resume
+    static constexpr float BYPASS_CROSSFADE_MS = 10.0f;
+
+    // Flush overlap-add and phase vocoder state before the engine restarts
+    void resumeSpectralEngine();
+
+    // SILENCE SUSPENSION: once input and output have been silent for longer than the
+    // OLA + delay tail and the feedback loop is empty, output zeros without running DSP
+    static constexpr float SILENCE_THRESHOLD = 1.0e-5f;  // -100 dBFS
+    int silentSampleCount = 0;      // Consecutive samples with silent input and output
+    bool silenceSuspended = false;  // Output-zero fast path active
+    int getSilenceTailSamples(bool delayOn, float delayTimeMs) const;
+    bool feedbackBuffersSilent() const;
+    void clearDelayLines();
+
+    // DUAL-MONO FAST PATH: when L/R input (and last output) match, process the left
+    // channel only and copy it to the right. Entered after MONO_ENTER_BLOCKS matching
+    // blocks, left immediately on the first mismatch (right state is synced from left).
+    static constexpr float MONO_MATCH_TOLERANCE = 1.0e-6f;
+    static constexpr int MONO_ENTER_BLOCKS = 8;
+    int monoMatchBlocks = 0;         // Consecutive blocks with matching L/R input and output
+    bool monoFastPathActive = false;
+    template <typename SampleType>
+    static bool channelsMatch(const SampleType* left, const SampleType* right, int numSamples);
+    void syncChannelState(int src, int dst);
+
     // Stereo decorrelation (testing feature)
     // Applies 0.06ms delay to left channel to reduce phase-locked resonance
     std::atomic<bool> stereoDecorrelateEnabled{ false };
-    std::vector<float> leftDecorrelateBuffer;
-    int decorrelateWritePos = 0;
+    fshift::RingBuffer<float> leftDecorrelateBuffer;
     int decorrelateDelaySamples = 0;
 
-    // Phase 2B+ Amplitude envelope tracking state (per channel)
-    // For matching output amplitude dynamics to input dynamics
-    std::array<float, MAX_CHANNELS> inputEnvelope{};   // Input amplitude follower
-    std::array<float, MAX_CHANNELS> outputEnvelope{};  // Output amplitude follower
-    // Envelope follower coefficients (computed in prepareToPlay)
+    // Phase 2B+ Amplitude envelope follower coefficients (computed in prepareToPlay)
     float envAttackCoeff = 0.0f;   // ~1ms attack
     float envReleaseCoeff = 0.0f;  // ~50ms release
 
@@ -277,76 +579,246 @@ private:
     // Current FFT settings for dual processors
     std::array<int, NUM_PROCESSORS> currentFftSizes = { 4096, 4096 };
     std::array<int, NUM_PROCESSORS> currentHopSizes = { 1024, 1024 };
+    std::array<int, NUM_PROCESSORS> currentFrameLatencies = { 4096, 4096 };  // STFT overlap-add latency
+    std::array<double, NUM_PROCESSORS> processorSampleRates = { 44100.0, 44100.0 };  // Lower for the BAND SPLIT low band
     float currentCrossfade = 0.0f;  // 0.0 = use processor 0, 1.0 = use processor 1
     bool useSingleProcessor = true;  // True when exactly on an FFT size boundary
 
     // Flag to reinitialize DSP on next block
     std::atomic<bool> needsReinit{ false };
 
-    // Reinitialize DSP components with new FFT settings
+    // Reinitialize DSP components with new FFT settings. On the audio thread this
+    // returns early, leaving needsReinit set, until the builder has staged objects
+    // for the new geometry.
     void reinitializeDsp();
 
+    // Everything the STFT, vocoder and shifter objects are constructed from
+    struct DspGeometry
+    {
+        std::array<int, NUM_PROCESSORS> fftSizes{};
+        std::array<int, NUM_PROCESSORS> hopSizes{};
+        std::array<int, NUM_PROCESSORS> frameLatencies{};  // Synthesis length, or fftSize
+        std::array<double, NUM_PROCESSORS> sampleRates{};
+        int numChannels = 0;
+        bool asymmetricWindows = false;
+        bool bandSplit = false;
+
+        bool operator==(const DspGeometry&) const = default;
+    };
+    DspGeometry getDspGeometry() const;
+    bool dspObjectsMatch(const DspGeometry& geometry) const;
+
     // Helper to calculate FFT size from ms latency
     int fftSizeFromMs(float ms) const;
 
     // Helper to get the two FFT sizes to blend and crossfade amount
     void getBlendParameters(float smearMs, int& fftSize1, int& fftSize2, float& crossfade) const;
 
-    // Input/output buffers for overlap-add (per channel, per processor)
-    std::array<std::array<std::vector<float>, NUM_PROCESSORS>, MAX_CHANNELS> inputBuffers;
-    std::array<std::array<std::vector<float>, NUM_PROCESSORS>, MAX_CHANNELS> outputBuffers;
-    std::array<std::array<int, NUM_PROCESSORS>, MAX_CHANNELS> inputWritePos{};
-    std::array<std::array<int, NUM_PROCESSORS>, MAX_CHANNELS> outputReadPos{};
-
-    // Delay compensation buffers (to maintain fixed latency to host)
-    std::array<std::vector<float>, MAX_CHANNELS> delayCompBuffers;
-    std::array<int, MAX_CHANNELS> delayCompWritePos{};
-    std::array<int, MAX_CHANNELS> delayCompReadPos{};
-
-    // Dry signal delay buffer (to align dry with wet when mixing)
-    // Must delay by full reported latency (MAX_FFT_SIZE samples)
-    std::array<std::vector<float>, MAX_CHANNELS> dryDelayBuffers;
-    std::array<int, MAX_CHANNELS> dryDelayWritePos{};
-
     // Time-domain feedback buffer for cascading pitch shifts
     // Feedback routes back to INPUT of shifter, so each repeat gets shifted again
     // Signal flow: Input + Feedback → FFT → Shift → Spectral Delay → IFFT → Output
     //                      ↑_____________________________________________↓
-    static constexpr int MAX_FEEDBACK_DELAY_SAMPLES = 96000;  // ~2 seconds at 48kHz
-    std::array<std::vector<float>, MAX_CHANNELS> feedbackBuffers;
-    std::array<int, MAX_CHANNELS> feedbackWritePos{};
+    static constexpr int MAX_FEEDBACK_DELAY_SAMPLES = 96000;  // ~2 seconds at 48kHz (rounded up to 2^17)
+
+    /**
+     * All mutable per-channel DSP state in one block. Each channel starts on its own
+     * cache line, so the two channels never share one (no false sharing if they are
+     * processed on separate threads). Ring storage is carved from bufferArena.
+     */
+    struct alignas(64) ChannelState
+    {
+        // Overlap-add rings per processor. Input rings mirror one frame so STFT
+        // frames are read contiguously; output rings are read (and cleared) at their head
+        std::array<fshift::RingBuffer<float>, NUM_PROCESSORS> inputBuffers;
+        std::array<fshift::RingBuffer<float>, NUM_PROCESSORS> outputBuffers;
+
+        // Samples pushed since the last STFT frame per processor (hops need not be powers of two)
+        std::array<int, NUM_PROCESSORS> hopPhases{};
+
+        // Lines and filters that carry the host's samples past the spectral engine, kept at
+        // the host's precision: a 64-bit host gets a bit-transparent dry path and feedback
+        // that recirculates in double. Only the set for the processing precision is laid out.
+        template <typename SampleType>
+        struct SampleLines
+        {
+            // Delay compensation (pads the OLA output up to the reported latency, see LatencyAlignment.h)
+            fshift::RingBuffer<SampleType> delayCompBuffer;
+
+            // Dry signal delay, by the full reported Spectral latency (see getSpectralLatencySamples)
+            fshift::RingBuffer<SampleType> dryDelayBuffer;
+
+            // Time-domain feedback line
+            fshift::RingBuffer<SampleType> feedbackBuffer;
+
+            // Per-block scratch: this block's dry input
+            std::span<SampleType> drySignal;
+
+            // Spectral feedback: one-pole damping lowpass and 150Hz highpass biquad [x1, x2, y1, y2]
+            SampleType feedbackFilterState = 0;
+            std::array<SampleType, 4> feedbackHpfState{};
+
+            // Classic feedback: DC blocker and 4th order Butterworth
+            SampleType classicDcBlockState = 0;
+            std::array<SampleType, 8> classicFbLpfState{};  // 2 cascaded biquads
+
+            void resetFeedbackFilters()
+            {
+                feedbackFilterState = 0;
+                feedbackHpfState.fill(0);
+                classicDcBlockState = 0;
+                classicFbLpfState.fill(0);
+            }
+
+            void release()
+            {
+                delayCompBuffer.release();
+                dryDelayBuffer.release();
+                feedbackBuffer.release();
+                drySignal = {};
+            }
+        };
+        SampleLines<float> floatLines;
+        SampleLines<double> doubleLines;
+
+        template <typename SampleType>
+        SampleLines<SampleType>& getLines()
+        {
+            if constexpr (std::is_same_v<SampleType, double>)
+                return doubleLines;
+            else
+                return floatLines;
+        }
+
+        // Whichever feedback line is laid out, and how many samples written to it in a row
+        // were silent (SILENCE SUSPENSION checks this count instead of scanning the line)
+        int getFeedbackCapacity() const
+        {
+            return std::max(floatLines.feedbackBuffer.getCapacity(), doubleLines.feedbackBuffer.getCapacity());
+        }
+        int feedbackSilentRun = 0;
+        void noteFeedbackWrite(double writtenPeak, int numWritten);
+
+        // Per-block scratch, currentBlockSize samples each (carved in layoutBuffers)
+        std::span<float> engineInput;                          // Dry input as float (64-bit hosts only)
+        std::span<float> feedbackInput;                        // Engine input plus feedback (DELAY on)
+        std::span<float> classicOutput;
+        std::array<std::span<float>, NUM_PROCESSORS> procOutputs;
+
+        // Phase 2B+ amplitude followers (match output dynamics to input dynamics)
+        float inputEnvelope = 0.0f;
+        float outputEnvelope = 0.0f;
+
+        // WARM lowpass biquad [x1, x2, y1, y2]
+        std::array<float, 4> warmFilterState{};
+
+        // Classic feedback: 4-pole lowpass stages
+        std::array<float, 4> feedbackLpf1State{};
+        std::array<float, 4> feedbackLpf2State{};
+        float crossFeedbackSample = 0.0f;  // Cross-coupled feedback (L→R, R→L)
+
+        // Hilbert shifter for Classic mode and spectral delays per processor
+        fshift::HilbertShifter hilbertShifter;
+        std::array<fshift::SpectralDelay, NUM_PROCESSORS> spectralDelays;
+
+        // BAND SPLIT crossover (high band feeds processor 0, decimated low band processor 1)
+        fshift::BandSplitter bandSplitter;
+
+        // Samples of each line that later processing can still read back
+        struct LiveLengths
+        {
+            std::array<int, NUM_PROCESSORS> frame{};  // STFT input history per processor
+            int latency = 0;                          // Dry and delay compensation history
+            int feedback = 0;                         // Feedback line history
+            float spectralDelayMs = 0.0f;             // Spectral delay history (before SLOPE)
+        };
+
+        // Copy another channel's state without allocating (dual mono sync). Long lines
+        // copy only their live portion; frame-sized state is copied whole.
+        void copyStateFrom(const ChannelState& other, const LiveLengths& live);
+    };
+    std::array<ChannelState, MAX_CHANNELS> channelStates;
+
+    // Single allocation backing every ring buffer (sized in reinitializeDsp)
+    fshift::DspArena bufferArena;
+    void layoutBuffers(int numChannels);
+
+    // Memory report published for any thread to read
+    std::array<std::atomic<size_t>, NUM_MEMORY_SUBSYSTEMS> memoryReportBytes{};
+    void updateMemoryReport();
+
+    // Setup timings published for any thread to read
+    std::array<std::atomic<double>, NUM_SETUP_STAGES> setupMicros{};
+    std::atomic<int> numReinits{ 0 };
+    void recordSetupTime(SetupStage stage, std::chrono::steady_clock::time_point start);
+
+    // Spectral delay lines are only allocated once the delay is switched on, and never
+    // on the audio thread: it requests lines for its current geometry, the table builder
+    // thread allocates them into the staging area, and the audio thread swaps them in.
+    // The staged lines belong to the audio thread only while delayLineState is STAGED.
+    enum DelayLineState
+    {
+        DELAY_LINES_IDLE,
+        DELAY_LINES_REQUESTED,  // Geometry below is set; builder is allocating
+        DELAY_LINES_STAGED      // Lines are ready to adopt
+    };
+    struct DelayLineStaging
+    {
+        std::array<int, NUM_PROCESSORS> numBins{};
+        std::array<int, NUM_PROCESSORS> delayMasks{};
+        std::array<std::array<fshift::SpectralDelay::Lines, NUM_PROCESSORS>, MAX_CHANNELS> lines;
+    };
+    std::atomic<int> delayLineState{ DELAY_LINES_IDLE };
+    DelayLineStaging delayLineStaging;
+    bool spectralDelaysAllocated() const;
+    void requestSpectralDelayLines();  // Audio thread
+    void stageSpectralDelayLines();    // Table builder thread
+    void adoptSpectralDelayLines();    // Audio thread
+
+    // The STFT, vocoder and shifter objects follow the same handshake. Constructing them
+    // takes the process-wide SharedTableCache locks and may build (or, by replacing an
+    // object, free) shared tables, so a reinit that changes their geometry asks the
+    // builder thread for a complete set and keeps running the old one until it is staged.
+    // Adopting swaps the sets, and the builder frees the replaced objects.
+    enum DspObjectState
+    {
+        DSP_OBJECTS_IDLE,
+        DSP_OBJECTS_REQUESTED,  // Geometry below is set; builder is constructing
+        DSP_OBJECTS_STAGED      // Objects are ready to adopt
+    };
+    struct DspObjectStaging
+    {
+        DspGeometry geometry;
+        std::array<std::array<std::unique_ptr<fshift::STFT>, NUM_PROCESSORS>, MAX_CHANNELS> stfts;
+        std::array<std::array<std::unique_ptr<fshift::PhaseVocoder>, NUM_PROCESSORS>, MAX_CHANNELS> vocoders;
+        std::array<std::array<std::unique_ptr<fshift::FrequencyShifter>, NUM_PROCESSORS>, MAX_CHANNELS> shifters;
+        std::unique_ptr<fshift::MusicalQuantizer> lowBandQuantizer;  // Only built for BAND SPLIT
+        std::array<std::shared_ptr<const fshift::MusicalQuantizer::EnvelopeLookup>, NUM_PROCESSORS> envelopeLookups;
+    };
+    std::atomic<int> dspObjectState{ DSP_OBJECTS_IDLE };
+    DspObjectStaging dspObjectStaging;
+    bool acquireDspObjects(const DspGeometry& geometry);  // Audio thread; true once adopted
+    void buildDspObjects();                               // With tableBuildMutex held
+    void stageDspObjects();                               // Table builder thread
 
-    // Simple one-pole lowpass for feedback damping
-    std::array<float, MAX_CHANNELS> feedbackFilterState{};
     float feedbackFilterCoeff = 0.5f;  // Calculated from damping parameter
 
-    // Two-pole highpass filter (150Hz) to prevent low frequency buildup
-    // Biquad state: [x1, x2, y1, y2] per channel
-    std::array<std::array<float, 4>, MAX_CHANNELS> feedbackHpfState{};
     // Biquad coefficients: [b0, b1, b2, a1, a2] (a0 normalized to 1)
     std::array<float, 5> feedbackHpfCoeffs{};
 
     // 4-pole (24dB/oct) lowpass filter (~4kHz) for Classic mode feedback
     // Aggressive filtering prevents aliasing artifacts from accumulating in delay taps
     // Two cascaded biquad stages for steeper rolloff (Eventide H3000/Orville style)
-    std::array<std::array<float, 4>, MAX_CHANNELS> feedbackLpf1State{};  // First biquad
-    std::array<std::array<float, 4>, MAX_CHANNELS> feedbackLpf2State{};  // Second biquad
     std::array<float, 5> feedbackLpfCoeffs{};  // Shared coefficients for both stages
 
-    // Cross-coupled feedback for Classic mode (L→R, R→L)
-    // Creates complex interference and stereo width like Eventide Orville
-    std::array<float, MAX_CHANNELS> crossFeedbackSample{};
-
     // Drift LFO for Classic mode - subtle modulation keeps feedback alive
     double driftLfoPhase = 0.0;
     static constexpr float DRIFT_LFO_RATE = 0.2f;   // ~0.2Hz for slow organic movement
+    void advanceDriftLfo(int numSamples);
     static constexpr float DRIFT_LFO_DEPTH = 0.5f;  // ~0.5Hz variation
 
     // Eventide-style feedback filters for Classic mode
     // DC blocker removes offset accumulation from imperfect sideband cancellation
     // 4th order Butterworth LPF (48 dB/oct) provides steep anti-aliasing
-    std::array<float, MAX_CHANNELS> classicDcBlockState{};  // DC blocker state per channel
-    std::array<std::array<float, 8>, MAX_CHANNELS> classicFbLpfState{};  // 4th order LPF state (2 cascaded biquads)
     std::array<float, 10> classicFbLpfCoeffs{};  // Coefficients for 2 cascaded biquads (5 each)
 
     // Tempo sync division multipliers (relative to quarter note)
@@ -370,10 +842,12 @@ private:
         16.0f     // 4/1
     };
 
-    // Spectrum visualization data (thread-safe FIFO)
-    std::array<float, SPECTRUM_SIZE> spectrumData{};
-    std::atomic<bool> spectrumDataReady{ false };
-    juce::SpinLock spectrumLock;
+    // Spectrum visualization data (wait-free, raw linear magnitudes)
+    fshift::TripleBuffer<std::array<float, SPECTRUM_SIZE>> spectrumBuffer;
+    void publishSpectrum(const std::vector<float>& magnitude);
+
+    // Quantizer note activity, copied from the quantizer after each channel 0 frame
+    fshift::TripleBuffer<std::array<float, fshift::MusicalQuantizer::NUM_MIDI_NOTES>> noteActivityBuffer;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FrequencyShifterProcessor)
 };
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <numbers>
+#include "RingBuffer.h"
+#include "DspArena.h"
+
+namespace fshift
+{
+
+/**
+ * BandSplitter - Multirate two-band crossover for the BAND SPLIT engine.
+ *
+ * The low band is lowpass filtered and decimated by `factor` with a polyphase
+ * FIR (only every factor-th output is computed), so it can be analysed with a
+ * long-window STFT at a fraction of the full-rate cost. The high band is the
+ * delayed input minus the decimated band interpolated back to full rate, which
+ * makes the split perfectly complementary: with no processing, high + low
+ * reconstructs the input delayed by getLatencySamples(), with any aliasing of
+ * the decimator cancelled rather than merely attenuated.
+ *
+ * After processing, combine() interpolates the processed low band (same
+ * polyphase filter) and delays whichever band has the shorter STFT latency so
+ * both come out aligned.
+ *
+ * Per sample: split(), then pushLow() if split() produced a low sample (after
+ * the low-rate STFT has consumed it), then combine().
+ */
+class BandSplitter
+{
+public:
+    // Filter length per polyphase branch; the FIR has TAPS_PER_PHASE * factor + 1 taps
+    static constexpr int TAPS_PER_PHASE = 24;
+
+    /** Crossover latency: decimation plus interpolation filter, both linear phase. */
+    static constexpr int getLatencySamples(int factor) { return TAPS_PER_PHASE * factor; }
+
+    BandSplitter() = default;
+    BandSplitter(const BandSplitter&) = delete;
+    BandSplitter& operator=(const BandSplitter&) = delete;
+
+    /**
+     * Design the filter and size the delay lines (not real-time safe).
+     *
+     * The lowpass cuts off at a quarter of the decimated rate (fs / (4 * factor))
+     * and is fully in its stopband by the decimated Nyquist, so the crossover
+     * sits an octave below the low band's Nyquist.
+     *
+     * @param newFactor Decimation factor of the low band (>= 2)
+     * @param newHighDelay Samples to delay the processed high band in combine()
+     * @param newLowDelay Samples to delay the interpolated low band in combine()
+     */
+    void prepare(int newFactor, int newHighDelay, int newLowDelay)
+    {
+        factor = std::max(2, newFactor);
+        highDelay = std::max(0, newHighDelay);
+        lowDelay = std::max(0, newLowDelay);
+
+        const int numTaps = TAPS_PER_PHASE * factor + 1;
+        const double cutoff = 1.0 / (4.0 * static_cast<double>(factor));  // cycles per sample
+        const double centre = 0.5 * static_cast<double>(numTaps - 1);
+
+        // Blackman-windowed sinc, normalized to unity DC gain
+        taps.assign(static_cast<size_t>(numTaps), 0.0f);
+        double sum = 0.0;
+        std::vector<double> design(static_cast<size_t>(numTaps));
+        for (int i = 0; i < numTaps; ++i)
+        {
+            const double t = static_cast<double>(i) - centre;
+            const double sinc = t == 0.0 ? 2.0 * cutoff
+                                         : std::sin(2.0 * std::numbers::pi * cutoff * t) / (std::numbers::pi * t);
+            const double phase = 2.0 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(numTaps - 1);
+            const double window = 0.42 - 0.5 * std::cos(phase) + 0.08 * std::cos(2.0 * phase);
+            design[static_cast<size_t>(i)] = sinc * window;
+            sum += design[static_cast<size_t>(i)];
+        }
+        for (int i = 0; i < numTaps; ++i)
+            taps[static_cast<size_t>(i)] = static_cast<float>(design[static_cast<size_t>(i)] / sum);
+
+        // Interpolator branches: branch p holds factor * h[p + j * factor] for j = TAPS_PER_PHASE..0
+        // (oldest low-rate sample first, matching RingBuffer::getWindow order)
+        branches.assign(static_cast<size_t>(factor * BRANCH_LENGTH), 0.0f);
+        for (int p = 0; p < factor; ++p)
+        {
+            for (int i = 0; i < BRANCH_LENGTH; ++i)
+            {
+                const int tap = p + (BRANCH_LENGTH - 1 - i) * factor;
+                if (tap < numTaps)
+                    branches[static_cast<size_t>(p * BRANCH_LENGTH + i)] = static_cast<float>(factor) * taps[static_cast<size_t>(tap)];
+            }
+        }
+
+        inputHistory.setSize(numTaps, numTaps);
+        referenceInterpolator.history.setSize(BRANCH_LENGTH, BRANCH_LENGTH);
+        outputInterpolator.history.setSize(BRANCH_LENGTH, BRANCH_LENGTH);
+        highAlign.setSize(highDelay + 1);
+        lowAlign.setSize(lowDelay + 1);
+        reset();
+    }
+
+    /** Clear all filter and delay state. */
+    void reset()
+    {
+        inputHistory.reset();
+        referenceInterpolator.reset();
+        decimationPhase = 0;
+        clearOutput();
+    }
+
+    /**
+     * Clear only the recombination side (processed-low interpolation and alignment),
+     * e.g. when the STFT output buffers are flushed but analysis history is kept.
+     */
+    void clearOutput()
+    {
+        outputInterpolator.reset();
+        highAlign.reset();
+        lowAlign.reset();
+    }
+
+    /** Copy state from a splitter with the same geometry (no allocation). */
+    void copyStateFrom(const BandSplitter& other)
+    {
+        inputHistory.copyStateFrom(other.inputHistory);
+        referenceInterpolator.copyStateFrom(other.referenceInterpolator);
+        outputInterpolator.copyStateFrom(other.outputInterpolator);
+        highAlign.copyStateFrom(other.highAlign);
+        lowAlign.copyStateFrom(other.lowAlign);
+        decimationPhase = other.decimationPhase;
+    }
+
+    /**
+     * Split one full-rate sample.
+     * @param input Full-rate input sample
+     * @param high Receives the high band sample (delayed by getLatencySamples())
+     * @param low Receives the next decimated low band sample when the function returns true
+     * @return True on every factor-th call, when a new low band sample is available
+     */
+    bool split(float input, float& high, float& low)
+    {
+        inputHistory.push(input);
+
+        bool hasLow = false;
+        if (++decimationPhase >= factor)
+        {
+            decimationPhase = 0;
+            const int numTaps = static_cast<int>(taps.size());
+            const float* window = inputHistory.getWindow(numTaps);
+            float sum = 0.0f;
+            for (int i = 0; i < numTaps; ++i)
+                sum += taps[static_cast<size_t>(i)] * window[i];  // Symmetric, so no reversal needed
+
+            low = sum;
+            referenceInterpolator.push(low);
+            hasLow = true;
+        }
+
+        // Complementary high band: x[n - latency] minus what the low band reconstructs to
+        const float delayedInput = inputHistory.getDelayed(static_cast<int>(taps.size()));
+        high = delayedInput - referenceInterpolator.next(branches, factor);
+        return hasLow;
+    }
+
+    /** Feed one processed low band sample (once per low sample produced by split()). */
+    void pushLow(float processedLow)
+    {
+        outputInterpolator.push(processedLow);
+    }
+
+    /**
+     * Recombine the processed bands for one full-rate sample.
+     * @param processedHigh Output of the high band STFT for this sample
+     * @return Aligned sum of the high band and the interpolated low band
+     */
+    float combine(float processedHigh)
+    {
+        float high = processedHigh;
+        float low = outputInterpolator.next(branches, factor);
+
+        if (highDelay > 0)
+        {
+            highAlign.push(high);
+            high = highAlign.getDelayed(highDelay + 1);
+        }
+        if (lowDelay > 0)
+        {
+            lowAlign.push(low);
+            low = lowAlign.getDelayed(lowDelay + 1);
+        }
+        return high + low;
+    }
+
+    int getFactor() const { return factor; }
+
+    /**
+     * Heap bytes owned by this instance.
+     */
+    size_t getMemoryBytes() const
+    {
+        return getVectorBytes(taps) + getVectorBytes(branches)
+             + inputHistory.getMemoryBytes() + referenceInterpolator.history.getMemoryBytes()
+             + outputInterpolator.history.getMemoryBytes() + highAlign.getMemoryBytes() + lowAlign.getMemoryBytes();
+    }
+
+private:
+    static constexpr int BRANCH_LENGTH = TAPS_PER_PHASE + 1;
+
+    /**
+     * Polyphase interpolator: one low-rate sample in, factor full-rate samples out.
+     */
+    struct Interpolator
+    {
+        RingBuffer<float> history;
+        int phase = 0;
+
+        void reset()
+        {
+            history.reset();
+            phase = 0;
+        }
+
+        void copyStateFrom(const Interpolator& other)
+        {
+            history.copyStateFrom(other.history);
+            phase = other.phase;
+        }
+
+        void push(float lowSample)
+        {
+            history.push(lowSample);
+            phase = 0;
+        }
+
+        float next(const std::vector<float>& branches, int factor)
+        {
+            const float* window = history.getWindow(BRANCH_LENGTH);
+            const float* branch = branches.data() + static_cast<size_t>(phase * BRANCH_LENGTH);
+            float sum = 0.0f;
+            for (int i = 0; i < BRANCH_LENGTH; ++i)
+                sum += branch[i] * window[i];
+
+            phase = std::min(phase + 1, factor - 1);
+            return sum;
+        }
+    };
+
+    int factor = 4;
+    int highDelay = 0;
+    int lowDelay = 0;
+    int decimationPhase = 0;
+
+    std::vector<float> taps;      // Lowpass prototype (symmetric)
+    std::vector<float> branches;  // Interpolator polyphase branches, factor x BRANCH_LENGTH
+
+    RingBuffer<float> inputHistory;  // Last numTaps inputs (decimator window and high band delay)
+    Interpolator referenceInterpolator;  // Unprocessed low band, for the complementary high band
+    Interpolator outputInterpolator;     // Processed low band
+    RingBuffer<float> highAlign;
+    RingBuffer<float> lowAlign;
+};
+
+} // namespace fshift
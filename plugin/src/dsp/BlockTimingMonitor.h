@@ -0,0 +1,268 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+namespace fshift
+{
+
+/**
+ * BlockTimingMonitor - Always-on processBlock deadline tracker.
+ *
+ * Each block's wall time is compared with its deadline (numSamples / sampleRate).
+ * The load ratio (elapsed / deadline) goes into a log2-bucket histogram, and the
+ * worst recent blocks are kept together with flags describing which code paths ran
+ * (FFT frame, DSP reinit, mode switch), so dropouts can be tied to plugin events.
+ *
+ * The worst list is time-bounded: blocks are ranked in two consecutive windows of
+ * WORST_WINDOW_SECONDS of audio, and the report merges the current and previous
+ * window, so it always covers the last one to two windows rather than the whole
+ * session (a reinit spike at startup no longer hides later dropouts).
+ *
+ * The audio thread never blocks: counters are relaxed atomics, and the worst-block
+ * list is published with a try-lock that is simply retried on the next block when
+ * a reader holds it.
+ */
+class BlockTimingMonitor
+{
+public:
+    /** Branch flags recorded with each block. */
+    enum Flags : std::uint32_t
+    {
+        FftFrame   = 1u << 0,  // At least one STFT frame was processed
+        Reinit     = 1u << 1,  // reinitializeDsp() ran (e.g. SMEAR change)
+        ModeSwitch = 1u << 2   // Classic/Spectral crossfade in progress
+    };
+
+    // Histogram bucket i >= 1 covers loads [2^(i - 10), 2^(i - 9)); bucket 0 holds
+    // everything below 2^-9 and the last bucket everything at or above 2x deadline.
+    static constexpr int NUM_BUCKETS = 12;
+    static constexpr int NUM_WORST = 16;
+    static constexpr double WORST_WINDOW_SECONDS = 10.0;
+
+    struct BlockRecord
+    {
+        std::uint64_t blockIndex = 0;
+        float elapsedMicros = 0.0f;
+        float deadlineMicros = 0.0f;
+        int numSamples = 0;
+        std::uint32_t flags = 0;
+
+        float getLoad() const { return deadlineMicros > 0.0f ? elapsedMicros / deadlineMicros : 0.0f; }
+    };
+
+    struct Report
+    {
+        std::array<std::uint64_t, NUM_BUCKETS> histogram{};
+        std::uint64_t totalBlocks = 0;
+        std::uint64_t missedDeadlines = 0;
+        std::array<BlockRecord, NUM_WORST> worstBlocks{};  // Last 1-2 windows, sorted, worst first
+        int numWorstBlocks = 0;
+    };
+
+    /**
+     * RAII scope for one processBlock call. Flags may be added while the block runs;
+     * the block is recorded when the scope ends, including on early returns.
+     */
+    class ScopedBlock
+    {
+    public:
+        ScopedBlock(BlockTimingMonitor& owner, int blockSamples, double blockSampleRate)
+            : monitor(owner), numSamples(blockSamples), sampleRate(blockSampleRate),
+              start(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~ScopedBlock()
+        {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            monitor.record(numSamples, sampleRate,
+                           std::chrono::duration<double, std::micro>(elapsed).count(), flags);
+        }
+
+        void setFlag(Flags flag) { flags |= flag; }
+
+        ScopedBlock(const ScopedBlock&) = delete;
+        ScopedBlock& operator=(const ScopedBlock&) = delete;
+
+    private:
+        BlockTimingMonitor& monitor;
+        int numSamples;
+        double sampleRate;
+        std::uint32_t flags = 0;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    /** Record one block (audio thread only). */
+    void record(int numSamples, double sampleRate, double elapsedMicros, std::uint32_t flags)
+    {
+        if (numSamples <= 0 || sampleRate <= 0.0)
+            return;
+
+        if (resetRequested.exchange(false, std::memory_order_acquire))
+            clearFromAudioThread();
+
+        BlockRecord block;
+        block.blockIndex = blockCounter++;
+        block.elapsedMicros = static_cast<float>(elapsedMicros);
+        block.deadlineMicros = static_cast<float>(1.0e6 * numSamples / sampleRate);
+        block.numSamples = numSamples;
+        block.flags = flags;
+
+        const float load = block.getLoad();
+        histogram[static_cast<size_t>(getBucketIndex(load))].fetch_add(1, std::memory_order_relaxed);
+        totalBlocks.fetch_add(1, std::memory_order_relaxed);
+        if (load >= 1.0f)
+            missedDeadlines.fetch_add(1, std::memory_order_relaxed);
+
+        // Start a new ranking window once the current one spans WORST_WINDOW_SECONDS
+        windowMicros += static_cast<double>(block.deadlineMicros);
+        if (windowMicros >= WORST_WINDOW_SECONDS * 1.0e6)
+        {
+            currentWindow = 1 - currentWindow;
+            windows[static_cast<size_t>(currentWindow)] = {};
+            windowMicros = 0.0;
+            worstDirty = true;
+        }
+
+        insertWorst(windows[static_cast<size_t>(currentWindow)], block);
+
+        if (worstDirty && !publishLock.test_and_set(std::memory_order_acquire))
+        {
+            publishedNumWorst = mergeWindows(publishedWorst);
+            publishLock.clear(std::memory_order_release);
+            worstDirty = false;
+        }
+    }
+
+    /** Copy the current statistics (any thread except the audio thread). */
+    Report getReport() const
+    {
+        Report report;
+        for (size_t i = 0; i < static_cast<size_t>(NUM_BUCKETS); ++i)
+            report.histogram[i] = histogram[i].load(std::memory_order_relaxed);
+        report.totalBlocks = totalBlocks.load(std::memory_order_relaxed);
+        report.missedDeadlines = missedDeadlines.load(std::memory_order_relaxed);
+
+        while (publishLock.test_and_set(std::memory_order_acquire))
+            std::this_thread::yield();
+        report.worstBlocks = publishedWorst;
+        report.numWorstBlocks = publishedNumWorst;
+        publishLock.clear(std::memory_order_release);
+
+        return report;
+    }
+
+    /** Ask the audio thread to clear all statistics at the start of its next block. */
+    void requestReset() { resetRequested.store(true, std::memory_order_release); }
+
+    static int getBucketIndex(float load)
+    {
+        if (!(load > 0.0f))
+            return 0;
+        const int index = static_cast<int>(std::floor(std::log2(load))) + 10;
+        return std::clamp(index, 0, NUM_BUCKETS - 1);
+    }
+
+    /** Lower load bound of a histogram bucket (0 for the first bucket). */
+    static float getBucketLowerLoad(int bucket)
+    {
+        return bucket <= 0 ? 0.0f : std::ldexp(1.0f, bucket - 10);
+    }
+
+    static std::string describeFlags(std::uint32_t flags)
+    {
+        std::string text;
+        auto append = [&text](const char* name)
+        {
+            if (!text.empty())
+                text += "+";
+            text += name;
+        };
+        if (flags & FftFrame)   append("FFT");
+        if (flags & Reinit)     append("REINIT");
+        if (flags & ModeSwitch) append("MODE");
+        return text.empty() ? "-" : text;
+    }
+
+private:
+    // Worst blocks of one ranking window, sorted by load, worst first
+    struct WorstList
+    {
+        std::array<BlockRecord, NUM_WORST> blocks{};
+        int count = 0;
+    };
+
+    void insertWorst(WorstList& list, const BlockRecord& block)
+    {
+        if (list.count == NUM_WORST && block.getLoad() <= list.blocks[NUM_WORST - 1].getLoad())
+            return;
+
+        int pos = list.count < NUM_WORST ? list.count++ : NUM_WORST - 1;
+        while (pos > 0 && list.blocks[static_cast<size_t>(pos - 1)].getLoad() < block.getLoad())
+        {
+            list.blocks[static_cast<size_t>(pos)] = list.blocks[static_cast<size_t>(pos - 1)];
+            --pos;
+        }
+        list.blocks[static_cast<size_t>(pos)] = block;
+        worstDirty = true;
+    }
+
+    /** Merge the two windows' lists into the NUM_WORST worst blocks; returns the count. */
+    int mergeWindows(std::array<BlockRecord, NUM_WORST>& merged) const
+    {
+        const auto& a = windows[0];
+        const auto& b = windows[1];
+        int ia = 0;
+        int ib = 0;
+        int count = 0;
+        while (count < NUM_WORST && (ia < a.count || ib < b.count))
+        {
+            const bool takeA = ib >= b.count
+                || (ia < a.count && a.blocks[static_cast<size_t>(ia)].getLoad() >= b.blocks[static_cast<size_t>(ib)].getLoad());
+            merged[static_cast<size_t>(count++)] = takeA ? a.blocks[static_cast<size_t>(ia++)]
+                                                         : b.blocks[static_cast<size_t>(ib++)];
+        }
+        std::fill(merged.begin() + count, merged.end(), BlockRecord{});
+        return count;
+    }
+
+    void clearFromAudioThread()
+    {
+        for (auto& bucket : histogram)
+            bucket.store(0, std::memory_order_relaxed);
+        totalBlocks.store(0, std::memory_order_relaxed);
+        missedDeadlines.store(0, std::memory_order_relaxed);
+        windows = {};
+        currentWindow = 0;
+        windowMicros = 0.0;
+        blockCounter = 0;
+        worstDirty = true;
+    }
+
+    // Shared counters
+    std::array<std::atomic<std::uint64_t>, NUM_BUCKETS> histogram{};
+    std::atomic<std::uint64_t> totalBlocks{0};
+    std::atomic<std::uint64_t> missedDeadlines{0};
+    std::atomic<bool> resetRequested{false};
+
+    // Audio-thread-owned worst lists (current and previous window)
+    std::array<WorstList, 2> windows{};
+    int currentWindow = 0;
+    double windowMicros = 0.0;  // Audio time covered by the current window
+    bool worstDirty = false;
+    std::uint64_t blockCounter = 0;
+
+    // Published copy for readers
+    mutable std::atomic_flag publishLock = ATOMIC_FLAG_INIT;
+    std::array<BlockRecord, NUM_WORST> publishedWorst{};
+    int publishedNumWorst = 0;
+};
+
+} // namespace fshift
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace fshift
+{
+
+/**
+ * DspArena - One contiguous, cache-line aligned allocation for DSP buffers.
+ *
+ * A layout runs twice in the same order: a measuring pass (after beginMeasure())
+ * only sums the aligned sizes and returns nullptr, then commit() allocates the
+ * total once and the second pass hands out the actual spans. Every span starts
+ * on its own cache line, so buffers of different channels never share one.
+ *
+ * The allocation only grows: re-laying out for an equal or smaller footprint
+ * (e.g. switching back to a smaller FFT size) reuses the existing block.
+ */
+class DspArena
+{
+public:
+    static constexpr size_t ALIGNMENT = 64;
+
+    /** Start a measuring pass (allocate() returns nullptr). */
+    void beginMeasure()
+    {
+        measuring = true;
+        offset = 0;
+    }
+
+    /** Allocate the measured size (if it grew) and start the real pass. */
+    void commit()
+    {
+        const size_t required = offset;
+        if (required > capacity)
+        {
+            block.reset(new std::byte[required + ALIGNMENT]);
+            auto address = reinterpret_cast<std::uintptr_t>(block.get());
+            base = block.get() + ((ALIGNMENT - address % ALIGNMENT) % ALIGNMENT);
+            capacity = required;
+        }
+        measuring = false;
+        offset = 0;
+    }
+
+    /** Reserve `count` elements (nullptr while measuring). */
+    template <typename T>
+    T* allocate(size_t count)
+    {
+        const size_t bytes = roundUp(count * sizeof(T));
+        T* result = nullptr;
+        if (!measuring)
+        {
+            assert(offset + bytes <= capacity);
+            result = reinterpret_cast<T*>(base + offset);
+        }
+        offset += bytes;
+        return result;
+    }
+
+    /** Free the block. Anything attached to it must be released first. */
+    void release()
+    {
+        block.reset();
+        base = nullptr;
+        capacity = 0;
+        offset = 0;
+        measuring = false;
+    }
+
+    bool isMeasuring() const { return measuring; }
+    size_t getUsedBytes() const { return offset; }
+    size_t getCapacityBytes() const { return capacity; }
+
+private:
+    static size_t roundUp(size_t bytes) { return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT; }
+
+    std::unique_ptr<std::byte[]> block;
+    std::byte* base = nullptr;
+    size_t capacity = 0;
+    size_t offset = 0;
+    bool measuring = false;
+};
+
+/** Heap bytes held by a vector (for per-instance memory reports). */
+template <typename T>
+size_t getVectorBytes(const std::vector<T>& v)
+{
+    return v.capacity() * sizeof(T);
+}
+
+} // namespace fshift
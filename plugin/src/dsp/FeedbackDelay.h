@@ -3,6 +3,7 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include "RingBuffer.h"
 
 namespace fshift
 {
@@ -34,9 +35,7 @@ public:
 
         // Allocate delay buffer for max delay time (1 second)
         int maxDelaySamples = static_cast<int>(std::ceil(maxDelayMs * sampleRate / 1000.0));
-        delayBuffer.resize(static_cast<size_t>(maxDelaySamples), 0.0f);
-
-        writePos = 0;
+        delayBuffer.setSize(maxDelaySamples);
     }
 
     /**
@@ -44,8 +43,7 @@ public:
      */
     void reset()
     {
-        std::fill(delayBuffer.begin(), delayBuffer.end(), 0.0f);
-        writePos = 0;
+        delayBuffer.reset();
     }
 
     /**
@@ -75,16 +73,11 @@ public:
      */
     void writeSample(float shifterOutput)
     {
-        if (delayBuffer.empty())
+        if (delayBuffer.isEmpty())
             return;
 
-        int bufferSize = static_cast<int>(delayBuffer.size());
-
-        // Write to buffer
-        delayBuffer[static_cast<size_t>(writePos)] = shifterOutput;
-
-        // Advance write position
-        writePos = (writePos + 1) % bufferSize;
+        // Write to buffer and advance write position
+        delayBuffer.push(shifterOutput);
     }
 
     /**
@@ -94,20 +87,17 @@ public:
      */
     float readDelayedSample()
     {
-        if (delayBuffer.empty())
+        if (delayBuffer.isEmpty())
             return 0.0f;
 
-        int bufferSize = static_cast<int>(delayBuffer.size());
+        int bufferSize = delayBuffer.getCapacity();
 
         // Calculate delay in samples
         int delaySamples = static_cast<int>(delayTimeMs * sampleRate / 1000.0f);
         delaySamples = std::clamp(delaySamples, 1, bufferSize - 1);
 
-        // Calculate read position (writePos was already advanced, so we subtract from writePos)
-        int readPos = (writePos - delaySamples + bufferSize) % bufferSize;
-
-        // Read delayed signal
-        float delayedSignal = delayBuffer[static_cast<size_t>(readPos)];
+        // Read delayed signal (write position was already advanced)
+        float delayedSignal = delayBuffer.getDelayed(delaySamples);
 
         // Apply mix
         return delayedSignal * mix;
@@ -146,8 +136,7 @@ public:
 private:
     double sampleRate = 44100.0;
 
-    std::vector<float> delayBuffer;
-    int writePos = 0;
+    RingBuffer<float> delayBuffer;
 
     float delayTimeMs = 250.0f;  // Default 250ms
     float mix = 0.5f;            // Default 50% mix
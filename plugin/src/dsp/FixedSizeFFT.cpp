@@ -0,0 +1,38 @@
+#include "FixedSizeFFT.h"
+
+namespace fshift
+{
+
+namespace
+{
+
+struct FixedSizeEntry
+{
+    int fftSize;
+    FFTKernel kernel;
+};
+
+// One instantiation per power-of-two size the plugin offers (PluginProcessor::FFT_SIZES),
+// plus 128 for the sub-transforms of the 384-point size (see MixedRadixFFT)
+constexpr FixedSizeEntry fixedSizeKernels[] = {
+    { 128,  &FixedSizeFFT<128>::forward },
+    { 256,  &FixedSizeFFT<256>::forward },
+    { 512,  &FixedSizeFFT<512>::forward },
+    { 1024, &FixedSizeFFT<1024>::forward },
+    { 2048, &FixedSizeFFT<2048>::forward },
+    { 4096, &FixedSizeFFT<4096>::forward },
+};
+
+} // namespace
+
+FFTKernel getFixedSizeFFT(int fftSize)
+{
+    for (const auto& entry : fixedSizeKernels)
+    {
+        if (entry.fftSize == fftSize)
+            return entry.kernel;
+    }
+    return nullptr;
+}
+
+} // namespace fshift
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace fshift
+{
+
+/**
+ * In-place forward FFT of a fixed size on interleaved complex data.
+ */
+using FFTKernel = void (*)(std::complex<float>* data);
+
+/**
+ * Specialized kernel for one of the plugin's FFT sizes, or nullptr if the size
+ * has no specialization (callers fall back to the generic transform).
+ */
+FFTKernel getFixedSizeFFT(int fftSize);
+
+namespace fftdetail
+{
+
+/**
+ * cos/sin of 2 * pi * k / n, usable in constant expressions.
+ *
+ * The angle is folded to within pi/4 of the nearest quarter turn, where a short
+ * Taylor series is accurate to double precision.
+ */
+constexpr std::pair<double, double> unitCircle(int k, int n)
+{
+    constexpr double twoPi = 6.283185307179586476925286766559;
+    const double turns = static_cast<double>(k) / static_cast<double>(n);
+    const int quarter = static_cast<int>(turns * 4.0 + 0.5);
+    const double x = twoPi * (turns - 0.25 * static_cast<double>(quarter));
+
+    double sinTerm = x, sinSum = x;
+    double cosTerm = 1.0, cosSum = 1.0;
+    for (int i = 1; i < 12; ++i)
+    {
+        sinTerm *= -x * x / static_cast<double>((2 * i) * (2 * i + 1));
+        cosTerm *= -x * x / static_cast<double>((2 * i - 1) * (2 * i));
+        sinSum += sinTerm;
+        cosSum += cosTerm;
+    }
+
+    switch (quarter & 3)
+    {
+        case 0:  return { cosSum, sinSum };
+        case 1:  return { -sinSum, cosSum };
+        case 2:  return { -cosSum, -sinSum };
+        default: return { sinSum, -cosSum };
+    }
+}
+
+} // namespace fftdetail
+
+/**
+ * Radix-2 FFT with every size-dependent quantity known at compile time.
+ *
+ * The bit-reversal permutation and the twiddles are constexpr tables in
+ * read-only memory. Twiddles are laid out per stage (the stage with half-size h
+ * reads entries [h, 2h)), so the inner butterfly loop walks them contiguously.
+ * Each stage is its own instantiation with constant trip counts, which lets the
+ * compiler unroll and vectorize the butterflies instead of going through the
+ * runtime-strided loop of the generic transform.
+ */
+template <int N>
+struct FixedSizeFFT
+{
+    static_assert(N >= 4 && (N & (N - 1)) == 0 && N <= 65536, "N must be a power of two in [4, 65536]");
+
+    static constexpr int log2Size = []
+    {
+        int bits = 0;
+        while ((1 << bits) < N)
+            ++bits;
+        return bits;
+    }();
+
+    struct Twiddles
+    {
+        std::array<float, N> re{};
+        std::array<float, N> im{};
+    };
+
+    static constexpr std::array<uint16_t, N> bitReversal = []
+    {
+        std::array<uint16_t, N> table{};
+        for (int i = 0; i < N; ++i)
+        {
+            int j = 0;
+            for (int b = 0; b < log2Size; ++b)
+                j |= ((i >> b) & 1) << (log2Size - 1 - b);
+            table[static_cast<size_t>(i)] = static_cast<uint16_t>(j);
+        }
+        return table;
+    }();
+
+    static constexpr Twiddles twiddles = []
+    {
+        Twiddles table{};
+        for (int half = 1; half < N; half *= 2)
+        {
+            for (int j = 0; j < half; ++j)
+            {
+                const auto [c, s] = fftdetail::unitCircle(j, 2 * half);
+                table.re[static_cast<size_t>(half + j)] = static_cast<float>(c);
+                table.im[static_cast<size_t>(half + j)] = static_cast<float>(-s);
+            }
+        }
+        return table;
+    }();
+
+    static void forward(std::complex<float>* data)
+    {
+        float* x = reinterpret_cast<float*>(data);
+
+        for (int i = 0; i < N; ++i)
+        {
+            const int j = bitReversal[static_cast<size_t>(i)];
+            if (j > i)
+                std::swap(data[i], data[j]);
+        }
+
+        // First stage: all twiddles are 1
+        for (int i = 0; i < 2 * N; i += 4)
+        {
+            const float re = x[i + 2], im = x[i + 3];
+            x[i + 2] = x[i] - re;
+            x[i + 3] = x[i + 1] - im;
+            x[i] += re;
+            x[i + 1] += im;
+        }
+
+        [x]<size_t... Stage>(std::index_sequence<Stage...>)
+        {
+            (butterflyStage<(2 << Stage)>(x), ...);
+        }(std::make_index_sequence<static_cast<size_t>(log2Size - 1)>{});
+    }
+
+private:
+    template <int Half>
+    static void butterflyStage(float* x)
+    {
+        const float* wRe = twiddles.re.data() + Half;
+        const float* wIm = twiddles.im.data() + Half;
+
+        for (int block = 0; block < N; block += 2 * Half)
+        {
+            float* even = x + 2 * block;
+            float* odd = even + 2 * Half;
+            for (int j = 0; j < Half; ++j)
+            {
+                const float oRe = odd[2 * j], oIm = odd[2 * j + 1];
+                const float tRe = oRe * wRe[j] - oIm * wIm[j];
+                const float tIm = oRe * wIm[j] + oIm * wRe[j];
+                odd[2 * j] = even[2 * j] - tRe;
+                odd[2 * j + 1] = even[2 * j + 1] - tIm;
+                even[2 * j] += tRe;
+                even[2 * j + 1] += tIm;
+            }
+        }
+    }
+};
+
+} // namespace fshift
@@ -3,6 +3,7 @@
 #include <vector>
 #include <cmath>
 #include <utility>
+#include "DspArena.h"
 
 namespace fshift
 {
@@ -71,6 +72,9 @@ public:
     int getNumBins() const { return numBins; }
     float getBinResolution() const { return binResolution; }
 
+    /** Heap bytes held by the bin frequency table. */
+    size_t getMemoryBytes() const { return getVectorBytes(originalFrequencies); }
+
 private:
     double sampleRate;
     int fftSize;
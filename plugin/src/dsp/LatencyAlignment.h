@@ -0,0 +1,36 @@
+#pragma once
+
+namespace fshift
+{
+
+/**
+ * Latency bookkeeping for the Spectral output stage.
+ *
+ * A path's frame latency (the FFT size, or the synthesis length with asymmetric
+ * windows) is one sample more than the delay its overlap-add output actually
+ * has: a frame is added into the output ring in the same sample that ring is
+ * read. The wet path is padded up to the reported latency by the delay
+ * compensation line, and the dry line is read at the reported latency, so the
+ * two line up for the dry/wet mix and the bypass crossfade.
+ */
+namespace latency
+{
+
+/** Samples by which an overlap-add path's output trails its input. */
+constexpr int getOlaPathDelay(int frameLatency) { return frameLatency - 1; }
+
+/**
+ * Delay compensation that brings a path with `frameLatency` up to the reported
+ * latency (at least one sample whenever frameLatency <= reportedLatency).
+ */
+constexpr int getCompensationDelay(int reportedLatency, int frameLatency)
+{
+    return reportedLatency - getOlaPathDelay(frameLatency);
+}
+
+/** RingBuffer::getDelayed() argument reading `delay` samples back, after the current sample is pushed. */
+constexpr int getTapAfterPush(int delay) { return delay + 1; }
+
+} // namespace latency
+
+} // namespace fshift
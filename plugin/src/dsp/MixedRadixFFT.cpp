@@ -0,0 +1,245 @@
+#include "MixedRadixFFT.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+namespace fshift
+{
+
+namespace
+{
+
+using Complex = std::complex<float>;
+
+// Explicit arithmetic: std::complex operator* checks for inf/nan and is not vectorized
+inline Complex multiply(Complex a, Complex w)
+{
+    return { a.real() * w.real() - a.imag() * w.imag(), a.real() * w.imag() + a.imag() * w.real() };
+}
+
+// Multiply by -i
+inline Complex rotateMinusI(Complex a)
+{
+    return { a.imag(), -a.real() };
+}
+
+template <int Radix>
+inline void butterfly(Complex* v)
+{
+    if constexpr (Radix == 2)
+    {
+        const Complex a = v[0], b = v[1];
+        v[0] = a + b;
+        v[1] = a - b;
+    }
+    else if constexpr (Radix == 3)
+    {
+        constexpr float c = -0.5f;
+        constexpr float s = -0.866025403784438646763723170753f;  // -sin(2pi/3)
+
+        const Complex t = v[1] + v[2];
+        const Complex d = v[1] - v[2];
+        const Complex m = v[0] + c * t;
+        const Complex n = { -s * d.imag(), s * d.real() };  // i * s * d
+        v[0] = v[0] + t;
+        v[1] = m + n;
+        v[2] = m - n;
+    }
+    else if constexpr (Radix == 4)
+    {
+        const Complex t0 = v[0] + v[2];
+        const Complex t1 = v[0] - v[2];
+        const Complex t2 = v[1] + v[3];
+        const Complex t3 = rotateMinusI(v[1] - v[3]);
+        v[0] = t0 + t2;
+        v[1] = t1 + t3;
+        v[2] = t0 - t2;
+        v[3] = t1 - t3;
+    }
+    else
+    {
+        static_assert(Radix == 5, "Unsupported radix");
+        constexpr float c1 = 0.309016994374947424102293417183f;    // cos(2pi/5)
+        constexpr float c2 = -0.809016994374947424102293417183f;   // cos(4pi/5)
+        constexpr float s1 = -0.951056516295153572116439333379f;   // -sin(2pi/5)
+        constexpr float s2 = -0.587785252292473129168705954639f;   // -sin(4pi/5)
+
+        const Complex t1 = v[1] + v[4];
+        const Complex t2 = v[2] + v[3];
+        const Complex d1 = v[1] - v[4];
+        const Complex d2 = v[2] - v[3];
+        const Complex m1 = v[0] + c1 * t1 + c2 * t2;
+        const Complex m2 = v[0] + c2 * t1 + c1 * t2;
+        const Complex e1 = s1 * d1 + s2 * d2;
+        const Complex e2 = s2 * d1 - s1 * d2;
+        const Complex n1 = { -e1.imag(), e1.real() };  // i * e1
+        const Complex n2 = { -e2.imag(), e2.real() };
+        v[0] = v[0] + t1 + t2;
+        v[1] = m1 + n1;
+        v[4] = m1 - n1;
+        v[2] = m2 + n2;
+        v[3] = m2 - n2;
+    }
+}
+
+/**
+ * One Stockham pass: output index (block * span * Radix + k + r * span) takes the
+ * radix-point DFT of inputs (block * span + k + r * size / Radix), twiddled by k.
+ */
+template <int Radix>
+void runPass(const Complex* src, Complex* dst, int size, int span, const Complex* twiddles)
+{
+    const int stride = size / Radix;
+    const int numBlocks = stride / span;
+
+    for (int block = 0; block < numBlocks; ++block)
+    {
+        const Complex* in = src + static_cast<size_t>(block) * static_cast<size_t>(span);
+        Complex* out = dst + static_cast<size_t>(block) * static_cast<size_t>(span * Radix);
+
+        for (int k = 0; k < span; ++k)
+        {
+            const Complex* w = twiddles + static_cast<size_t>(k) * (Radix - 1);
+
+            Complex v[Radix];
+            v[0] = in[k];
+            for (int r = 1; r < Radix; ++r)
+                v[r] = multiply(in[k + r * stride], w[r - 1]);
+
+            butterfly<Radix>(v);
+
+            for (int r = 0; r < Radix; ++r)
+                out[k + r * span] = v[r];
+        }
+    }
+}
+
+/**
+ * Split plan combine step: sub-transform q (length subSize, stored at q * subSize)
+ * holds the DFT of x[Radix * m + q]. Output k + j * subSize is the radix-point DFT
+ * over q of sub_q[k] * exp(-2 pi i q k / size).
+ */
+template <int Radix>
+void combineSplit(const Complex* sub, Complex* dst, int subSize, const Complex* twiddles)
+{
+    for (int k = 0; k < subSize; ++k)
+    {
+        const Complex* w = twiddles + static_cast<size_t>(k) * (Radix - 1);
+
+        Complex v[Radix];
+        v[0] = sub[k];
+        for (int q = 1; q < Radix; ++q)
+            v[q] = multiply(sub[static_cast<size_t>(q * subSize + k)], w[q - 1]);
+
+        butterfly<Radix>(v);
+
+        for (int j = 0; j < Radix; ++j)
+            dst[static_cast<size_t>(k + j * subSize)] = v[j];
+    }
+}
+
+// w(k, r) = exp(-2 pi i r k / length), r = 1..radix-1, appended for k = 0..count-1
+void appendTwiddles(std::vector<Complex>& twiddles, int radix, int count, int length)
+{
+    for (int k = 0; k < count; ++k)
+    {
+        for (int r = 1; r < radix; ++r)
+        {
+            const double angle = -2.0 * std::numbers::pi * static_cast<double>(r * k) / static_cast<double>(length);
+            twiddles.emplace_back(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+        }
+    }
+}
+
+} // namespace
+
+MixedRadixFFT::MixedRadixFFT(int newSize)
+    : size(newSize)
+{
+    if (!isSupportedSize(size))
+    {
+        throw std::invalid_argument("FFT size must be a product of 2, 3 and 5");
+    }
+
+    for (int radix : { 3, 5 })
+    {
+        if (size % radix == 0 && getFixedSizeFFT(size / radix) != nullptr)
+        {
+            subKernel = getFixedSizeFFT(size / radix);
+            splitRadix = radix;
+            appendTwiddles(twiddles, radix, size / radix, size);
+            return;
+        }
+    }
+
+    int remaining = size;
+    int span = 1;
+    for (int radix : { 4, 2, 3, 5 })
+    {
+        while (remaining % radix == 0)
+        {
+            passes.push_back({ radix, span, twiddles.size() });
+            appendTwiddles(twiddles, radix, span, span * radix);
+            remaining /= radix;
+            span *= radix;
+        }
+    }
+}
+
+bool MixedRadixFFT::isSupportedSize(int size)
+{
+    if (size <= 0)
+        return false;
+
+    for (int factor : { 2, 3, 5 })
+    {
+        while (size % factor == 0)
+            size /= factor;
+    }
+    return size == 1;
+}
+
+void MixedRadixFFT::forward(Complex* data, Complex* scratch) const
+{
+    if (subKernel != nullptr)
+    {
+        // Deinterleave into the scratch buffer, transform each part, combine back
+        const int subSize = size / splitRadix;
+        for (int q = 0; q < splitRadix; ++q)
+        {
+            Complex* sub = scratch + static_cast<size_t>(q * subSize);
+            for (int m = 0; m < subSize; ++m)
+                sub[m] = data[static_cast<size_t>(m * splitRadix + q)];
+            subKernel(sub);
+        }
+
+        if (splitRadix == 3)
+            combineSplit<3>(scratch, data, subSize, twiddles.data());
+        else
+            combineSplit<5>(scratch, data, subSize, twiddles.data());
+        return;
+    }
+
+    Complex* src = data;
+    Complex* dst = scratch;
+
+    for (const auto& pass : passes)
+    {
+        const Complex* w = twiddles.data() + pass.twiddleOffset;
+        switch (pass.radix)
+        {
+            case 2:  runPass<2>(src, dst, size, pass.span, w); break;
+            case 3:  runPass<3>(src, dst, size, pass.span, w); break;
+            case 4:  runPass<4>(src, dst, size, pass.span, w); break;
+            default: runPass<5>(src, dst, size, pass.span, w); break;
+        }
+        std::swap(src, dst);
+    }
+
+    // An odd number of passes leaves the result in the scratch buffer
+    if (src != data)
+        std::copy(src, src + size, data);
+}
+
+} // namespace fshift
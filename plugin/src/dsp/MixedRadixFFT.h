@@ -0,0 +1,73 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+#include "FixedSizeFFT.h"
+
+namespace fshift
+{
+
+/**
+ * MixedRadixFFT - forward FFT for any size whose prime factors are 2, 3 and 5.
+ *
+ * Sizes of the form 3 * 2^k or 5 * 2^k whose power-of-two part has a FixedSizeFFT
+ * kernel (the plugin's 384, 768, 1536 and 3072) are split by decimation in time:
+ * the interleaved sub-sequences go through the specialized kernel and one
+ * radix-3/5 pass combines them, so they run at close to power-of-two speed.
+ *
+ * Every other size uses a Stockham autosort formulation: each pass reads one
+ * buffer and writes the other in natural order, so there is no bit-reversal step
+ * and the same code serves every factorization. Radix-4 passes are used while the
+ * size allows, then radix 2, 3 and 5.
+ *
+ * Twiddles are computed once per size; plans are immutable and can be shared
+ * (see SharedTableCache).
+ */
+class MixedRadixFFT
+{
+public:
+    /**
+     * Build the plan for a size.
+     * @param size Transform length (> 0, no prime factors other than 2, 3, 5)
+     */
+    explicit MixedRadixFFT(int size);
+
+    /**
+     * True if size is positive and factors into 2, 3 and 5 only.
+     */
+    static bool isSupportedSize(int size);
+
+    /**
+     * In-place forward transform.
+     * @param data size complex values
+     * @param scratch size complex values of working space (contents are clobbered)
+     */
+    void forward(std::complex<float>* data, std::complex<float>* scratch) const;
+
+    int getSize() const { return size; }
+
+    /** Heap bytes held by the plan (twiddles and pass list). */
+    size_t getMemoryBytes() const
+    {
+        return twiddles.capacity() * sizeof(std::complex<float>) + passes.capacity() * sizeof(Pass);
+    }
+
+private:
+    struct Pass
+    {
+        int radix;
+        int span;              // Product of the radices of earlier passes
+        size_t twiddleOffset;  // span * (radix - 1) entries from here
+    };
+
+    int size;
+    std::vector<Pass> passes;
+    std::vector<std::complex<float>> twiddles;
+
+    // Split plan: size = splitRadix * (power-of-two size of subKernel)
+    FFTKernel subKernel = nullptr;
+    int splitRadix = 0;
+};
+
+} // namespace fshift
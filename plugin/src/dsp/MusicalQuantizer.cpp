@@ -1,4 +1,5 @@
 #include "MusicalQuantizer.h"
+#include "SimdKernels.h"
 #include <algorithm>
 #include <cmath>
 
@@ -180,19 +181,8 @@ void MusicalQuantizer::applyMagnitudeSmoothing(std::vector<float>& magnitude)
     size_t numBins = magnitude.size();
     std::vector<float> smoothed(numBins);
 
-    // First bin: just use original (boundary condition)
-    smoothed[0] = magnitude[0];
-
-    // Middle bins: apply 3-tap kernel
-    for (size_t k = 1; k < numBins - 1; ++k)
-    {
-        smoothed[k] = 0.25f * magnitude[k - 1] +
-                      0.50f * magnitude[k] +
-                      0.25f * magnitude[k + 1];
-    }
-
-    // Last bin: just use original (boundary condition)
-    smoothed[numBins - 1] = magnitude[numBins - 1];
+    // 3-tap kernel on the middle bins; first and last bins keep their original values
+    simd::smooth3(magnitude.data(), smoothed.data(), static_cast<int>(numBins));
 
     // Copy back
     magnitude = std::move(smoothed);
@@ -227,6 +217,30 @@ void MusicalQuantizer::buildEnvelopeLookupTables(double sampleRate, int fftSize)
     cachedFftSizeForLookup = fftSize;
     cachedSampleRateForLookup = sampleRate;
 
+    envelopeLookup = acquireEnvelopeLookup(sampleRate, fftSize);
+}
+
+std::shared_ptr<const MusicalQuantizer::EnvelopeLookup> MusicalQuantizer::acquireEnvelopeLookup(double sampleRate,
+                                                                                                int fftSize)
+{
+    return SharedTableCache<std::pair<int, double>, EnvelopeLookup>::get(
+        { fftSize, sampleRate },
+        [sampleRate, fftSize] { return createEnvelopeLookup(sampleRate, fftSize); });
+}
+
+void MusicalQuantizer::adoptEnvelopeLookup(std::shared_ptr<const EnvelopeLookup>& lookup, double sampleRate, int fftSize)
+{
+    envelopeLookup.swap(lookup);
+    cachedFftSizeForLookup = fftSize;
+    cachedSampleRateForLookup = sampleRate;
+}
+
+MusicalQuantizer::EnvelopeLookup MusicalQuantizer::createEnvelopeLookup(double sampleRate, int fftSize)
+{
+    EnvelopeLookup lookup;
+    auto& binToBandLookup = lookup.binToBandLookup;
+    auto& bandBinRanges = lookup.bandBinRanges;
+
     int numBins = fftSize / 2 + 1;
     float binResolution = static_cast<float>(sampleRate) / static_cast<float>(fftSize);
     float nyquist = static_cast<float>(sampleRate) / 2.0f;
@@ -282,6 +296,8 @@ void MusicalQuantizer::buildEnvelopeLookupTables(double sampleRate, int fftSize)
 
         bandBinRanges[static_cast<size_t>(band)] = {lowBin, highBin};
     }
+
+    return lookup;
 }
 
 std::vector<float> MusicalQuantizer::captureSpectralEnvelopeFast(
@@ -289,6 +305,7 @@ std::vector<float> MusicalQuantizer::captureSpectralEnvelopeFast(
 {
     // OPTIMIZED: Uses pre-computed band bin ranges
     std::vector<float> envelope(NUM_ENVELOPE_BANDS, 0.0f);
+    const auto& bandBinRanges = envelopeLookup->bandBinRanges;
     const int magSize = static_cast<int>(magnitude.size());
 
     for (int band = 0; band < NUM_ENVELOPE_BANDS; ++band)
@@ -352,6 +369,7 @@ void MusicalQuantizer::applySpectralEnvelopeFast(
     }
 
     // Apply ratios using lookup table (single loop, no nested search)
+    const auto& binToBandLookup = envelopeLookup->binToBandLookup;
     int lookupSize = static_cast<int>(binToBandLookup.size());
     for (int k = 1; k < numBins && k < lookupSize; ++k)
     {
@@ -551,7 +569,10 @@ std::pair<std::vector<float>, std::vector<float>> MusicalQuantizer::quantizeSpec
     const std::vector<float>* preShiftEnvelope)
 {
     if (strength <= 0.0f)
+    {
+        midiNoteMagnitude.fill(0.0f);
         return { magnitude, phase };
+    }
 
     strength = std::clamp(strength, 0.0f, 1.0f);
 
@@ -587,6 +608,7 @@ std::pair<std::vector<float>, std::vector<float>> MusicalQuantizer::quantizeSpec
     if (effectiveStrength <= 0.001f)
     {
         // Still need to update transient detection state for next frame
+        midiNoteMagnitude.fill(0.0f);
         return { magnitude, phase };
     }
 
@@ -611,15 +633,10 @@ std::pair<std::vector<float>, std::vector<float>> MusicalQuantizer::quantizeSpec
     std::vector<float> strongestContributorPhase(static_cast<size_t>(numBins), 0.0f);
 
     // Track which MIDI notes received energy this frame (for decay tracking)
-    std::array<float, NUM_MIDI_NOTES> midiNoteMagnitude{};
     midiNoteMagnitude.fill(0.0f);
 
     // Phase 2A.2: Calculate total energy BEFORE quantization
-    float energyBefore = 0.0f;
-    for (int k = 0; k < numBins; ++k)
-    {
-        energyBefore += magnitude[static_cast<size_t>(k)] * magnitude[static_cast<size_t>(k)];
-    }
+    const float energyBefore = simd::sumOfSquares(magnitude.data(), numBins);
 
     // Calculate bin frequencies and target bins
     // Strategy A: Use weighted energy distribution to two nearest scale bins
@@ -730,20 +747,13 @@ std::pair<std::vector<float>, std::vector<float>> MusicalQuantizer::quantizeSpec
     applyMagnitudeSmoothing(quantizedMagnitude);
 
     // Phase 2A.2: Calculate total energy AFTER quantization+smoothing and normalize
-    float energyAfter = 0.0f;
-    for (int k = 0; k < numBins; ++k)
-    {
-        energyAfter += quantizedMagnitude[static_cast<size_t>(k)] * quantizedMagnitude[static_cast<size_t>(k)];
-    }
+    const float energyAfter = simd::sumOfSquares(quantizedMagnitude.data(), numBins);
 
     // Apply energy normalization scale factor
     if (energyAfter > 1e-10f)
     {
         float scaleFactor = std::sqrt(energyBefore / energyAfter);
-        for (int k = 0; k < numBins; ++k)
-        {
-            quantizedMagnitude[static_cast<size_t>(k)] *= scaleFactor;
-        }
+        simd::scale(quantizedMagnitude.data(), scaleFactor, numBins);
     }
 
     // Phase 2B+ OPTIMIZED: Apply spectral envelope preservation
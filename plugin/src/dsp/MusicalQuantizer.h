@@ -1,8 +1,12 @@
 #pragma once
 
+#include <array>
+#include <memory>
 #include <vector>
 #include <utility>
 #include "Scales.h"
+#include "DspArena.h"
+#include "SharedTableCache.h"
 
 namespace fshift
 {
@@ -123,7 +127,7 @@ public:
         // Build lookup tables if needed
         buildEnvelopeLookupTables(sampleRate, fftSize);
         // Use fast method if tables are ready
-        if (!bandBinRanges.empty())
+        if (envelopeLookup != nullptr)
             return captureSpectralEnvelopeFast(magnitude);
         // Fallback to original method
         return captureSpectralEnvelope(magnitude, sampleRate, fftSize);
@@ -143,10 +147,57 @@ public:
     void setTransientAmount(float amount) { transientAmount = std::clamp(amount, 0.0f, 1.0f); }
     void setTransientSensitivity(float sensitivity) { transientSensitivity = std::clamp(sensitivity, 0.0f, 1.0f); }
 
+    static constexpr int NUM_MIDI_NOTES = 128;
+
+    /**
+     * Per-note energy gathered by the last quantizeSpectrum call (index = MIDI note).
+     * All zeros when the last frame was bypassed (strength 0 or transient).
+     */
+    const std::array<float, NUM_MIDI_NOTES>& getNoteMagnitudes() const { return midiNoteMagnitude; }
+
     // Getters
     int getRootMidi() const { return rootMidi; }
     ScaleType getScaleType() const { return scaleType; }
-    const std::vector<int>& getScaleDegrees() const { return scaleDegrees; }
+    const ScaleDegrees& getScaleDegrees() const { return scaleDegrees; }
+
+    /** Bytes held by the quantizer (the shared envelope lookup tables are not counted). */
+    size_t getMemoryBytes() const
+    {
+        return sizeof(*this);
+    }
+
+    /** Bytes of the shared envelope lookup tables this quantizer references. */
+    size_t getSharedMemoryBytes() const
+    {
+        return envelopeLookup != nullptr
+            ? getVectorBytes(envelopeLookup->binToBandLookup) + getVectorBytes(envelopeLookup->bandBinRanges)
+            : 0;
+    }
+
+    struct EnvelopeLookup
+    {
+        // Pre-computed bin-to-band mapping (avoids nested loop with log calls)
+        // Index = bin number, Value = closest envelope band index
+        std::vector<int> binToBandLookup;
+
+        // Pre-computed band bin ranges for envelope capture
+        // Each pair is (lowBin, highBin) for that band
+        std::vector<std::pair<int, int>> bandBinRanges;
+    };
+
+    /**
+     * Fetch the shared envelope lookup tables for an FFT size / sample rate.
+     * Takes the table cache lock (and may build the tables), so call it off
+     * the audio thread and hand the result to adoptEnvelopeLookup().
+     */
+    static std::shared_ptr<const EnvelopeLookup> acquireEnvelopeLookup(double sampleRate, int fftSize);
+
+    /**
+     * Install tables from acquireEnvelopeLookup() without locking. The tables this
+     * quantizer held are swapped into `lookup`, so the caller decides where they
+     * are released.
+     */
+    void adoptEnvelopeLookup(std::shared_ptr<const EnvelopeLookup>& lookup, double sampleRate, int fftSize);
 
 private:
     /**
@@ -226,14 +277,16 @@ private:
 
     int rootMidi;
     ScaleType scaleType;
-    std::vector<int> scaleDegrees;
+    ScaleDegrees scaleDegrees;
 
     // Phase 2A: Phase continuity state
     // Persistent phase accumulators indexed by MIDI note (0-127)
     // This allows consistent phase across different FFT sizes
-    static constexpr int NUM_MIDI_NOTES = 128;
     std::array<float, NUM_MIDI_NOTES> midiPhaseAccumulators{};
 
+    // Energy mapped onto each MIDI note in the last quantized frame
+    std::array<float, NUM_MIDI_NOTES> midiNoteMagnitude{};
+
     // Silent frame counter per MIDI note - tracks how long since significant energy
     // Resets phase accumulator after SILENCE_FRAMES_TO_RESET consecutive silent frames
     std::array<int, NUM_MIDI_NOTES> silentFrameCount{};
@@ -273,20 +326,21 @@ private:
     mutable int cachedFftSizeForLookup = 0;
     mutable double cachedSampleRateForLookup = 0.0;
 
-    // Pre-computed bin-to-band mapping (avoids nested loop with log calls)
-    // Index = bin number, Value = closest envelope band index
-    mutable std::vector<int> binToBandLookup;
-
-    // Pre-computed band bin ranges for envelope capture
-    // Each pair is (lowBin, highBin) for that band
-    mutable std::vector<std::pair<int, int>> bandBinRanges;
+    // Shared by every quantizer running at the same FFT size / sample rate
+    mutable std::shared_ptr<const EnvelopeLookup> envelopeLookup;
 
     /**
-     * Build lookup tables for current FFT size / sample rate.
+     * Fetch lookup tables for current FFT size / sample rate from the shared cache,
+     * unless adoptEnvelopeLookup() already installed them.
      * Called once when parameters change, not every frame.
      */
     void buildEnvelopeLookupTables(double sampleRate, int fftSize) const;
 
+    /**
+     * Compute the envelope lookup tables for an FFT size / sample rate.
+     */
+    static EnvelopeLookup createEnvelopeLookup(double sampleRate, int fftSize);
+
     /**
      * Optimized envelope capture using pre-computed lookup tables.
      */
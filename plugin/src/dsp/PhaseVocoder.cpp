@@ -1,6 +1,7 @@
 #include "PhaseVocoder.h"
 #include <algorithm>
 #include <cmath>
+#include <tuple>
 
 namespace fshift
 {
@@ -18,25 +19,39 @@ PhaseVocoder::PhaseVocoder(int fftSize, int hopSize, double sampleRate)
     prevMagnitude.resize(numBins, 0.0f);
     prevPhase.resize(numBins, 0.0f);
     prevSynthPhase.resize(numBins, 0.0f);
+    peakMagDb.resize(numBins, 0.0f);
 
-    // Pre-compute bin frequencies
-    binFrequencies.resize(numBins);
-    for (int i = 0; i < numBins; ++i)
-    {
-        // Bin frequency formula: bin_freq[k] = k * sample_rate / fft_size
-        // Since numBins = fftSize/2 + 1, we have fftSize = 2*(numBins-1)
-        // So this is equivalent to: k * sample_rate / fft_size
-        binFrequencies[i] = static_cast<float>(i) * static_cast<float>(sampleRate)
-                            / static_cast<float>(2 * (numBins - 1));
-    }
+    // Pre-compute hop-dependent phase/frequency conversion factors
+    phaseAdvancePerHz = 2.0f * std::numbers::pi_v<float> * static_cast<float>(hopSize)
+                        / static_cast<float>(sampleRate);
+    hzPerPhaseDeviation = 1.0f / phaseAdvancePerHz;
 
-    // Pre-compute expected phase advance per hop
-    expectedPhaseAdvance.resize(numBins);
-    for (int i = 0; i < numBins; ++i)
-    {
-        expectedPhaseAdvance[i] = 2.0f * std::numbers::pi_v<float> * binFrequencies[i]
-                                  * static_cast<float>(hopSize) / static_cast<float>(sampleRate);
-    }
+    // Per-bin tables are shared by every vocoder with the same geometry
+    binTables = SharedTableCache<std::tuple<int, int, double>, BinTables>::get(
+        { fftSize, hopSize, sampleRate },
+        [numBins = numBins, sampleRate, advancePerHz = phaseAdvancePerHz]
+        {
+            BinTables tables;
+
+            // Pre-compute bin frequencies
+            tables.binFrequencies.resize(static_cast<size_t>(numBins));
+            for (int i = 0; i < numBins; ++i)
+            {
+                // Bin frequency formula: bin_freq[k] = k * sample_rate / fft_size
+                // Since numBins = fftSize/2 + 1, we have fftSize = 2*(numBins-1)
+                // So this is equivalent to: k * sample_rate / fft_size
+                tables.binFrequencies[static_cast<size_t>(i)] = static_cast<float>(i) * static_cast<float>(sampleRate)
+                                                                / static_cast<float>(2 * (numBins - 1));
+            }
+
+            // Pre-compute expected phase advance per hop
+            tables.expectedPhaseAdvance.resize(static_cast<size_t>(numBins));
+            for (int i = 0; i < numBins; ++i)
+            {
+                tables.expectedPhaseAdvance[static_cast<size_t>(i)] = tables.binFrequencies[static_cast<size_t>(i)] * advancePerHz;
+            }
+            return tables;
+        });
 }
 
 void PhaseVocoder::reset()
@@ -56,18 +71,25 @@ float PhaseVocoder::wrapPhase(float phase)
 std::vector<bool> PhaseVocoder::detectPeaks(const std::vector<float>& magnitude)
 {
     std::vector<bool> peaks(numBins, false);
+    detectPeaks(magnitude, peaks);
+    return peaks;
+}
+
+void PhaseVocoder::detectPeaks(const std::vector<float>& magnitude, std::vector<bool>& peaks)
+{
+    peaks.assign(static_cast<size_t>(numBins), false);
 
     if (numBins < 3)
-        return peaks;
+        return;
 
     // Convert to dB and find threshold
     float maxMagDb = -std::numeric_limits<float>::infinity();
-    std::vector<float> magDb(numBins);
+    peakMagDb.resize(static_cast<size_t>(numBins));
 
     for (int i = 0; i < numBins; ++i)
     {
-        magDb[i] = 20.0f * std::log10(magnitude[i] + 1e-10f);
-        maxMagDb = std::max(maxMagDb, magDb[i]);
+        peakMagDb[i] = 20.0f * std::log10(magnitude[i] + 1e-10f);
+        maxMagDb = std::max(maxMagDb, peakMagDb[i]);
     }
 
     float threshold = maxMagDb + peakThresholdDb;
@@ -75,19 +97,19 @@ std::vector<bool> PhaseVocoder::detectPeaks(const std::vector<float>& magnitude)
     // Find local maxima above threshold
     for (int i = 1; i < numBins - 1; ++i)
     {
-        if (magDb[i] > threshold && magDb[i] > magDb[i - 1] && magDb[i] > magDb[i + 1])
+        if (peakMagDb[i] > threshold && peakMagDb[i] > peakMagDb[i - 1] && peakMagDb[i] > peakMagDb[i + 1])
         {
             peaks[i] = true;
         }
     }
-
-    return peaks;
 }
 
 std::vector<float> PhaseVocoder::computeInstantaneousFrequency(const std::vector<float>& phasePrev,
                                                                 const std::vector<float>& phaseCurr)
 {
     std::vector<float> instFreq(numBins);
+    const auto& binFrequencies = binTables->binFrequencies;
+    const auto& expectedPhaseAdvance = binTables->expectedPhaseAdvance;
 
     for (int i = 0; i < numBins; ++i)
     {
@@ -104,9 +126,7 @@ std::vector<float> PhaseVocoder::computeInstantaneousFrequency(const std::vector
         phaseDeviation = wrapPhase(phaseDeviation);
 
         // Instantaneous frequency = bin frequency + deviation
-        instFreq[i] = binFrequencies[i]
-                      + phaseDeviation * static_cast<float>(sampleRate)
-                        / (2.0f * std::numbers::pi_v<float> * static_cast<float>(hopSize));
+        instFreq[i] = binFrequencies[i] + phaseDeviation * hzPerPhaseDeviation;
     }
 
     return instFreq;
@@ -157,8 +177,7 @@ std::vector<float> PhaseVocoder::synthesizePhase(const std::vector<float>& instF
         float shiftedFreq = instFreq[i] + shiftHz;
 
         // Phase advance based on shifted frequency
-        float phaseAdvance = 2.0f * std::numbers::pi_v<float> * shiftedFreq
-                             * static_cast<float>(hopSize) / static_cast<float>(sampleRate);
+        float phaseAdvance = shiftedFreq * phaseAdvancePerHz;
 
         // Synthesize new phase
         newPhase[i] = wrapPhase(phasePrevSynth[i] + phaseAdvance);
@@ -170,6 +189,18 @@ std::vector<float> PhaseVocoder::synthesizePhase(const std::vector<float>& instF
 std::vector<float> PhaseVocoder::process(const std::vector<float>& magnitude,
                                           const std::vector<float>& phase,
                                           float shiftHz)
+{
+    // No peaks needed on the first frame (phase is copied through) or without locking
+    if (firstFrame || !usePhaseLocking)
+        return process(magnitude, phase, shiftHz, std::vector<bool>{});
+
+    return process(magnitude, phase, shiftHz, detectPeaks(magnitude));
+}
+
+std::vector<float> PhaseVocoder::process(const std::vector<float>& magnitude,
+                                          const std::vector<float>& phase,
+                                          float shiftHz,
+                                          const std::vector<bool>& peaks)
 {
     std::vector<float> outputPhase(numBins);
 
@@ -184,9 +215,8 @@ std::vector<float> PhaseVocoder::process(const std::vector<float>& magnitude,
     {
         // Apply phase locking if enabled
         std::vector<float> lockedPhase = phase;
-        if (usePhaseLocking)
+        if (usePhaseLocking && static_cast<int>(peaks.size()) == numBins)
         {
-            std::vector<bool> peaks = detectPeaks(magnitude);
             lockedPhase = phaseLockVertical(phase, magnitude, peaks);
         }
 
@@ -207,4 +237,31 @@ std::vector<float> PhaseVocoder::process(const std::vector<float>& magnitude,
     return outputPhase;
 }
 
+std::vector<float> PhaseVocoder::process(const std::vector<float>& magnitude,
+                                          const std::vector<float>& phase,
+                                          const std::vector<float>& instFreq,
+                                          float shiftHz)
+{
+    std::vector<float> outputPhase(numBins);
+
+    if (firstFrame)
+    {
+        // First frame: just copy phase
+        outputPhase = phase;
+        firstFrame = false;
+    }
+    else
+    {
+        // Reassigned frequencies are already consistent across a peak's main lobe,
+        // so no vertical phase locking is needed here
+        outputPhase = synthesizePhase(instFreq, prevSynthPhase, shiftHz);
+    }
+
+    prevSynthPhase = outputPhase;
+    prevMagnitude = magnitude;
+    prevPhase = phase;
+
+    return outputPhase;
+}
+
 } // namespace fshift
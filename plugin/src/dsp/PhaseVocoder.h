@@ -2,7 +2,10 @@
 
 #include <vector>
 #include <cmath>
+#include <memory>
 #include <numbers>
+#include "DspArena.h"
+#include "SharedTableCache.h"
 
 namespace fshift
 {
@@ -29,7 +32,8 @@ public:
      * Construct phase vocoder processor.
      *
      * @param fftSize FFT size
-     * @param hopSize Hop size in samples
+     * @param hopSize Hop size in samples (fftSize / overlap factor; all
+     *                phase-advance tables are derived from it)
      * @param sampleRate Sample rate in Hz
      */
     PhaseVocoder(int fftSize, int hopSize, double sampleRate);
@@ -53,6 +57,54 @@ public:
                                const std::vector<float>& phase,
                                float shiftHz);
 
+    /**
+     * Process a single frame with a precomputed peak structure.
+     *
+     * Used for stereo-linked analysis: peaks are detected once on a combined
+     * spectrum and shared by both channels, so their phase locking regions
+     * (and therefore L/R phase relationships) stay identical. Only the phase
+     * propagation runs per channel.
+     *
+     * @param magnitude Current frame magnitude spectrum
+     * @param phase Current frame phase spectrum
+     * @param shiftHz Frequency shift amount in Hz
+     * @param peaks Peak flags per bin (from detectPeaks on the linked spectrum)
+     * @return Synthesized phase for the shifted spectrum
+     */
+    std::vector<float> process(const std::vector<float>& magnitude,
+                               const std::vector<float>& phase,
+                               float shiftHz,
+                               const std::vector<bool>& peaks);
+
+    /**
+     * Detect spectral peaks in magnitude spectrum.
+     */
+    std::vector<bool> detectPeaks(const std::vector<float>& magnitude);
+
+    /**
+     * Detect spectral peaks into a caller-owned flag vector.
+     *
+     * Does not allocate once peaks holds getNumBins() entries, so it can run on
+     * the audio thread with buffers sized at prepare time.
+     */
+    void detectPeaks(const std::vector<float>& magnitude, std::vector<bool>& peaks);
+
+    /**
+     * Process a single frame using externally estimated instantaneous
+     * frequencies (e.g. STFT reassignment) instead of the frame-to-frame
+     * phase difference, which is only unambiguous with heavy overlap.
+     *
+     * @param magnitude Current frame magnitude spectrum
+     * @param phase Current frame phase spectrum
+     * @param instFreq Instantaneous frequency per bin in Hz
+     * @param shiftHz Frequency shift amount in Hz
+     * @return Synthesized phase for the shifted spectrum
+     */
+    std::vector<float> process(const std::vector<float>& magnitude,
+                               const std::vector<float>& phase,
+                               const std::vector<float>& instFreq,
+                               float shiftHz);
+
     /**
      * Set peak detection threshold in dB.
      */
@@ -68,12 +120,30 @@ public:
      */
     void setUsePhaseLocking(bool enabled) { usePhaseLocking = enabled; }
 
-private:
     /**
-     * Detect spectral peaks in magnitude spectrum.
+     * Whether phase locking (and therefore peak detection) is in use.
      */
-    std::vector<bool> detectPeaks(const std::vector<float>& magnitude);
+    bool getUsePhaseLocking() const { return usePhaseLocking; }
+
+    // Geometry getters
+    int getNumBins() const { return numBins; }
+    int getHopSize() const { return hopSize; }
+    double getSampleRate() const { return sampleRate; }
+
+    /** Heap bytes held by phase state (the shared per-bin tables are not counted). */
+    size_t getMemoryBytes() const
+    {
+        return getVectorBytes(prevMagnitude) + getVectorBytes(prevPhase) + getVectorBytes(prevSynthPhase)
+             + getVectorBytes(peakMagDb);
+    }
+
+    /** Bytes of the shared per-bin tables this vocoder references. */
+    size_t getSharedMemoryBytes() const
+    {
+        return getVectorBytes(binTables->binFrequencies) + getVectorBytes(binTables->expectedPhaseAdvance);
+    }
 
+private:
     /**
      * Compute instantaneous frequency for each bin.
      */
@@ -107,6 +177,7 @@ private:
     std::vector<float> prevMagnitude;
     std::vector<float> prevPhase;
     std::vector<float> prevSynthPhase;
+    std::vector<float> peakMagDb;  // detectPeaks scratch
     bool firstFrame;
 
     // Parameters
@@ -114,9 +185,15 @@ private:
     int regionSize;
     bool usePhaseLocking;
 
-    // Pre-computed values
-    std::vector<float> binFrequencies;
-    std::vector<float> expectedPhaseAdvance;
+    // Pre-computed per-bin values (depend on fftSize, hopSize and sampleRate)
+    struct BinTables
+    {
+        std::vector<float> binFrequencies;
+        std::vector<float> expectedPhaseAdvance;
+    };
+    std::shared_ptr<const BinTables> binTables;
+    float phaseAdvancePerHz;      // 2*pi * hopSize / sampleRate
+    float hzPerPhaseDeviation;    // sampleRate / (2*pi * hopSize)
 };
 
 } // namespace fshift
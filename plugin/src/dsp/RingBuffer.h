@@ -0,0 +1,249 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include <vector>
+#include "SimdKernels.h"
+
+namespace fshift
+{
+
+/**
+ * RingBuffer - Power-of-two circular buffer with bitmask indexing.
+ *
+ * Capacity is rounded up to a power of two so wrapping is a single AND instead
+ * of an integer division. The buffer tracks its own head (next write position).
+ *
+ * An optional mirror region duplicates the first mirrorSize slots after the end
+ * of the storage, so any window of up to mirrorSize samples starting anywhere in
+ * the ring can be read as one contiguous span (e.g. an STFT input frame).
+ *
+ * Block operations split into at most two contiguous segments and use std::copy
+ * or the SIMD kernels (float accumulation).
+ *
+ * Storage is either owned (setSize) or borrowed from an arena (attach). Copying
+ * is explicit via copyStateFrom() so a borrowed ring never aliases another one.
+ */
+template <typename T>
+class RingBuffer
+{
+public:
+    static int nextPowerOfTwo(int n)
+    {
+        int size = 1;
+        while (size < n)
+            size <<= 1;
+        return size;
+    }
+
+    RingBuffer() = default;
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    /** Number of elements (ring + mirror) needed for a given geometry. */
+    static int getStorageSize(int minimumCapacity, int mirrorLength = 0)
+    {
+        const int size = nextPowerOfTwo(std::max(1, minimumCapacity));
+        return size + std::clamp(mirrorLength, 0, size);
+    }
+
+    /**
+     * Allocate owned storage and clear the buffer (not real-time safe).
+     * @param minimumCapacity Capacity is rounded up to the next power of two
+     * @param mirrorLength Longest contiguous window getWindow() must support
+     */
+    void setSize(int minimumCapacity, int mirrorLength = 0)
+    {
+        ownedStorage.assign(static_cast<size_t>(getStorageSize(minimumCapacity, mirrorLength)), T{});
+        setGeometry(ownedStorage.data(), minimumCapacity, mirrorLength);
+    }
+
+    /**
+     * Use external storage of getStorageSize(minimumCapacity, mirrorLength)
+     * elements (e.g. from a DspArena) and clear it. Never allocates.
+     */
+    void attach(T* memory, int minimumCapacity, int mirrorLength = 0)
+    {
+        ownedStorage = {};
+        setGeometry(memory, minimumCapacity, mirrorLength);
+        clear();
+    }
+
+    /** Drop the storage (frees it if owned). */
+    void release()
+    {
+        ownedStorage = {};
+        storage = nullptr;
+        capacity = 0;
+        mask = 0;
+        mirrorSize = 0;
+        head = 0;
+    }
+
+    /** Copy contents and head from a ring of the same geometry (no allocation). */
+    void copyStateFrom(const RingBuffer& other)
+    {
+        assert(capacity == other.capacity && mirrorSize == other.mirrorSize);
+        if (capacity != other.capacity || mirrorSize != other.mirrorSize)
+            return;
+        std::copy(other.storage, other.storage + capacity + mirrorSize, storage);
+        head = other.head;
+    }
+
+    /**
+     * Copy the head and the `count` most recent samples from a ring of the same
+     * geometry (no allocation). Older slots keep their previous contents, so use
+     * this only where nothing further back than `count` samples is read.
+     */
+    void copyRecentFrom(const RingBuffer& other, int count)
+    {
+        assert(capacity == other.capacity && mirrorSize == other.mirrorSize);
+        if (capacity != other.capacity || mirrorSize != other.mirrorSize)
+            return;
+
+        count = std::clamp(count, 0, capacity);
+        head = other.head;
+        const int start = (head - count) & mask;
+        const int first = std::min(count, capacity - start);
+        copyIn(start, other.storage + start, first);
+        copyIn(0, other.storage, count - first);
+    }
+
+    /** Zero the contents, keeping the head position. */
+    void clear()
+    {
+        if (storage != nullptr)
+            std::fill(storage, storage + capacity + mirrorSize, T{});
+    }
+
+    /** Zero the contents and rewind the head. */
+    void reset()
+    {
+        clear();
+        head = 0;
+    }
+
+    bool isEmpty() const { return capacity == 0; }
+    int getCapacity() const { return capacity; }
+    int getHead() const { return head; }
+
+    /** Raw ring storage (capacity samples, mirror excluded). */
+    const T* data() const { return storage; }
+
+    /** Bytes of storage in use (ring + mirror). */
+    size_t getMemoryBytes() const { return static_cast<size_t>(capacity + mirrorSize) * sizeof(T); }
+
+    /** Write one sample at the head and advance. */
+    void push(T value)
+    {
+        storage[static_cast<size_t>(head)] = value;
+        if (head < mirrorSize)
+            storage[static_cast<size_t>(capacity + head)] = value;
+        head = (head + 1) & mask;
+    }
+
+    /** Write a block of samples at the head and advance. */
+    void write(const T* source, int numSamples)
+    {
+        // Only the newest `capacity` samples can survive a larger write
+        if (numSamples > capacity)
+        {
+            head = (head + numSamples - capacity) & mask;
+            source += numSamples - capacity;
+            numSamples = capacity;
+        }
+
+        int first = std::min(numSamples, capacity - head);
+        copyIn(head, source, first);
+        copyIn(0, source + first, numSamples - first);
+        head = (head + numSamples) & mask;
+    }
+
+    /** Sample written `delay` pushes before the head (1 = most recent). */
+    T getDelayed(int delay) const { return storage[static_cast<size_t>((head - delay) & mask)]; }
+
+    /** Element at an arbitrary position; the index is wrapped. */
+    T& at(int index) { return storage[static_cast<size_t>(index & mask)]; }
+
+    /**
+     * Contiguous view of the `length` samples ending at the head.
+     * Requires length <= the mirror length given to setSize().
+     */
+    const T* getWindow(int length) const
+    {
+        assert(length <= mirrorSize);
+        return storage + ((head - length) & mask);
+    }
+
+    /** Read the sample at the head, zero it and advance (overlap-add output). */
+    T popAndClear()
+    {
+        T value = storage[static_cast<size_t>(head)];
+        storage[static_cast<size_t>(head)] = T{};
+        if (head < mirrorSize)
+            storage[static_cast<size_t>(capacity + head)] = T{};
+        head = (head + 1) & mask;
+        return value;
+    }
+
+    /** Accumulate a block into the ring starting `offset` samples past the head. */
+    void addFrom(int offset, const T* source, int numSamples)
+    {
+        int start = (head + offset) & mask;
+        int first = std::min(numSamples, capacity - start);
+        addIn(start, source, first);
+        addIn(0, source + first, numSamples - first);
+    }
+
+private:
+    void setGeometry(T* memory, int minimumCapacity, int mirrorLength)
+    {
+        storage = memory;
+        capacity = nextPowerOfTwo(std::max(1, minimumCapacity));
+        mask = capacity - 1;
+        mirrorSize = std::clamp(mirrorLength, 0, capacity);
+        head = 0;
+    }
+
+    void copyIn(int start, const T* source, int count)
+    {
+        if (count <= 0)
+            return;
+        std::copy(source, source + count, storage + start);
+
+        // Keep the mirror in sync with the slots it duplicates
+        int mirrored = std::min(count, mirrorSize - start);
+        if (mirrored > 0)
+            std::copy(source, source + mirrored, storage + capacity + start);
+    }
+
+    void addIn(int start, const T* source, int count)
+    {
+        if (count <= 0)
+            return;
+        T* dest = storage + start;
+        if constexpr (std::is_same_v<T, float>)
+        {
+            simd::add(dest, source, count);
+        }
+        else
+        {
+            for (int i = 0; i < count; ++i)
+                dest[i] += source[i];
+        }
+
+        int mirrored = std::min(count, mirrorSize - start);
+        if (mirrored > 0)
+            std::copy(dest, dest + mirrored, storage + capacity + start);
+    }
+
+    std::vector<T> ownedStorage;
+    T* storage = nullptr;
+    int capacity = 0;
+    int mask = 0;
+    int mirrorSize = 0;
+    int head = 0;
+};
+
+} // namespace fshift
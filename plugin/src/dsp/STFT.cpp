@@ -1,6 +1,8 @@
 #include "STFT.h"
+#include "SimdKernels.h"
 #include <stdexcept>
 #include <numbers>
+#include <tuple>
 
 namespace fshift
 {
@@ -13,10 +15,10 @@ STFT::STFT(int fftSize, int hopSize, WindowType windowType)
       sampleRate(44100.0),
       binResolution(0.0f)
 {
-    // Validate FFT size is power of 2
-    if (fftSize <= 0 || (fftSize & (fftSize - 1)) != 0)
+    // Validate FFT size: even (DC..Nyquist bins) and 2/3/5-smooth
+    if (fftSize % 2 != 0 || !MixedRadixFFT::isSupportedSize(fftSize))
     {
-        throw std::invalid_argument("FFT size must be a power of 2");
+        throw std::invalid_argument("FFT size must be even with prime factors 2, 3 and 5 only");
     }
 
     if (hopSize <= 0 || hopSize > fftSize)
@@ -24,18 +26,18 @@ STFT::STFT(int fftSize, int hopSize, WindowType windowType)
         throw std::invalid_argument("Hop size must be positive and <= FFT size");
     }
 
-    createWindow();
+    updateWindowTables();
 
     // Allocate buffers
     fftBuffer.resize(fftSize);
 
-    // Pre-compute twiddle factors for FFT
-    twiddleFactors.resize(fftSize / 2);
-    for (int i = 0; i < fftSize / 2; ++i)
-    {
-        float angle = -2.0f * std::numbers::pi_v<float> * static_cast<float>(i) / static_cast<float>(fftSize);
-        twiddleFactors[i] = std::complex<float>(std::cos(angle), std::sin(angle));
-    }
+    fixedSizeKernel = getFixedSizeFFT(fftSize);
+    if (fixedSizeKernel != nullptr)
+        return;
+
+    // The plan depends only on the FFT size, so all instances share it
+    mixedRadixPlan = SharedTableCache<int, MixedRadixFFT>::get(fftSize, [fftSize] { return MixedRadixFFT(fftSize); });
+    fftScratch.resize(static_cast<size_t>(fftSize));
 }
 
 void STFT::prepare(double newSampleRate)
@@ -49,8 +51,30 @@ void STFT::reset()
     std::fill(fftBuffer.begin(), fftBuffer.end(), std::complex<float>(0.0f, 0.0f));
 }
 
-void STFT::createWindow()
+void STFT::updateWindowTables()
+{
+    using WindowKey = std::tuple<int, int, WindowType, int>;
+    windows = SharedTableCache<WindowKey, WindowTables>::get(
+        { fftSize, hopSize, windowType, synthesisLength },
+        [this] { return buildWindowTables(fftSize, hopSize, windowType, synthesisLength); });
+}
+
+STFT::WindowTables STFT::buildWindowTables(int fftSize, int hopSize, WindowType windowType, int synthesisLength)
 {
+    WindowTables tables;
+    createWindow(tables, fftSize, windowType);
+    if (synthesisLength > 0)
+        createAsymmetricWindows(tables, fftSize, synthesisLength);
+
+    normalizeSynthesisWindow(tables, fftSize, hopSize);
+    createDerivativeWindow(tables, fftSize, synthesisLength == 0);
+    return tables;
+}
+
+void STFT::createWindow(WindowTables& tables, int fftSize, WindowType windowType)
+{
+    auto& window = tables.window;
+    auto& windowSquared = tables.windowSquared;
     window.resize(fftSize);
     windowSquared.resize(fftSize);
 
@@ -78,31 +102,176 @@ void STFT::createWindow()
 
         windowSquared[i] = window[i] * window[i];
     }
+
+    tables.synthesisWindow = window;
+}
+
+void STFT::createDerivativeWindow(WindowTables& tables, int fftSize, bool periodic)
+{
+    // Central difference of the analysis window. The symmetric windows are periodic,
+    // so wrap at the edges; asymmetric windows use one-sided differences there.
+    const auto& window = tables.window;
+    auto& derivativeWindow = tables.derivativeWindow;
+    derivativeWindow.resize(fftSize);
+    for (int i = 0; i < fftSize; ++i)
+    {
+        int prev = i - 1;
+        int next = i + 1;
+        float span = 2.0f;
+        if (prev < 0)
+        {
+            prev = periodic ? fftSize - 1 : 0;
+            span = periodic ? 2.0f : 1.0f;
+        }
+        if (next >= fftSize)
+        {
+            next = periodic ? 0 : fftSize - 1;
+            span = periodic ? 2.0f : 1.0f;
+        }
+        derivativeWindow[i] = (window[next] - window[prev]) / span;
+    }
+}
+
+void STFT::normalizeSynthesisWindow(WindowTables& tables, int fftSize, int hopSize)
+{
+    for (int phase = 0; phase < hopSize; ++phase)
+    {
+        float sum = 0.0f;
+        for (int i = phase; i < fftSize; i += hopSize)
+            sum += tables.window[static_cast<size_t>(i)] * tables.synthesisWindow[static_cast<size_t>(i)];
+
+        if (sum > 1.0e-6f)
+        {
+            for (int i = phase; i < fftSize; i += hopSize)
+                tables.synthesisWindow[static_cast<size_t>(i)] /= sum;
+        }
+    }
+}
+
+void STFT::setAsymmetricWindows(int newSynthesisLength)
+{
+    if (newSynthesisLength == 0)
+    {
+        synthesisLength = 0;
+        updateWindowTables();
+        return;
+    }
+
+    if (newSynthesisLength % 2 != 0 || newSynthesisLength < 2 * hopSize || newSynthesisLength >= fftSize)
+    {
+        throw std::invalid_argument("Synthesis length must be even and in [2 * hopSize, fftSize)");
+    }
+
+    synthesisLength = newSynthesisLength;
+    updateWindowTables();
+}
+
+void STFT::createAsymmetricWindows(WindowTables& tables, int fftSize, int synthesisLength)
+{
+    const float pi = std::numbers::pi_v<float>;
+    const int halfSynthesis = synthesisLength / 2;
+    const int riseLength = fftSize - halfSynthesis;
+    const int synthesisStart = fftSize - synthesisLength;
+    auto& window = tables.window;
+
+    // Keep the same coherent gain as the symmetric window so magnitudes
+    // (spectrum display, quantizer thresholds) don't change with the window shape
+    float symmetricSum = 0.0f;
+    for (float w : window)
+        symmetricSum += w;
+
+    // Analysis: sqrt-Hann rising over fftSize - M, sqrt-Hann falling over the last M samples
+    float analysisSum = 0.0f;
+    for (int i = 0; i < fftSize; ++i)
+    {
+        float w;
+        if (i < riseLength)
+            w = std::sqrt(0.5f * (1.0f - std::cos(pi * static_cast<float>(i) / static_cast<float>(riseLength))));
+        else
+            w = std::sqrt(0.5f * (1.0f + std::cos(pi * static_cast<float>(i - riseLength) / static_cast<float>(halfSynthesis))));
+
+        window[static_cast<size_t>(i)] = w;
+        analysisSum += w;
+    }
+
+    const float analysisScale = analysisSum > 0.0f ? symmetricSum / analysisSum : 1.0f;
+    for (int i = 0; i < fftSize; ++i)
+    {
+        window[static_cast<size_t>(i)] *= analysisScale;
+        tables.windowSquared[static_cast<size_t>(i)] = window[static_cast<size_t>(i)] * window[static_cast<size_t>(i)];
+    }
+
+    // Synthesis: Hann(2M) / analysis over the last 2M samples, so the product is a short Hann
+    // (normalizeSynthesisWindow then makes analysis * synthesis sum to exactly 1 at every phase of the hop)
+    auto& synthesisWindow = tables.synthesisWindow;
+    std::fill(synthesisWindow.begin(), synthesisWindow.end(), 0.0f);
+    for (int i = synthesisStart; i < fftSize; ++i)
+    {
+        float n = static_cast<float>(i - synthesisStart);
+        float hann = 0.5f * (1.0f - std::cos(2.0f * pi * n / static_cast<float>(synthesisLength)));
+        float analysis = window[static_cast<size_t>(i)];
+        synthesisWindow[static_cast<size_t>(i)] = analysis > 1.0e-6f ? hann / analysis : 0.0f;
+    }
 }
 
 std::pair<std::vector<float>, std::vector<float>> STFT::forward(const std::vector<float>& inputFrame)
 {
-    if (static_cast<int>(inputFrame.size()) != fftSize)
+    return forward(inputFrame.data(), static_cast<int>(inputFrame.size()));
+}
+
+std::pair<std::vector<float>, std::vector<float>> STFT::forward(const float* inputFrame, int numSamples)
+{
+    if (numSamples != fftSize)
     {
         throw std::invalid_argument("Input frame size must match FFT size");
     }
 
-    // Apply window and copy to FFT buffer
-    for (int i = 0; i < fftSize; ++i)
+    std::vector<float> magnitude(numBins);
+    std::vector<float> phase(numBins);
+    const auto& window = windows->window;
+
+    if (reassignmentEnabled)
     {
-        fftBuffer[i] = std::complex<float>(inputFrame[i] * window[i], 0.0f);
+        // Pack window (real) and derivative window (imag) frames into one FFT
+        simd::windowToComplex(inputFrame, window.data(), windows->derivativeWindow.data(), fftBuffer.data(), fftSize);
+
+        fft(fftBuffer);
+
+        reassignedFrequencies.resize(numBins);
+        const float hzPerRadian = static_cast<float>(sampleRate) / (2.0f * std::numbers::pi_v<float>);
+
+        for (int i = 0; i < numBins; ++i)
+        {
+            // Split the two real-input spectra using conjugate symmetry
+            auto z = fftBuffer[i];
+            auto zMirror = std::conj(fftBuffer[(fftSize - i) % fftSize]);
+            auto windowed = 0.5f * (z + zMirror);
+            auto derivative = std::complex<float>(0.0f, -0.5f) * (z - zMirror);
+
+            magnitude[i] = std::abs(windowed);
+            phase[i] = std::arg(windowed);
+
+            // f = f_k - Im(X_dh / X_h) * fs / 2pi (falls back to bin centre in silence)
+            float binFrequency = static_cast<float>(i) * binResolution;
+            float power = std::norm(windowed);
+            reassignedFrequencies[i] = power > 1.0e-12f
+                ? binFrequency - (derivative * std::conj(windowed)).imag() / power * hzPerRadian
+                : binFrequency;
+        }
+
+        return { magnitude, phase };
     }
 
+    // Apply window and copy to FFT buffer
+    simd::windowToComplex(inputFrame, window.data(), nullptr, fftBuffer.data(), fftSize);
+
     // Perform FFT
     fft(fftBuffer);
 
     // Extract magnitude and phase (positive frequencies only)
-    std::vector<float> magnitude(numBins);
-    std::vector<float> phase(numBins);
-
+    simd::complexMagnitude(fftBuffer.data(), magnitude.data(), numBins);
     for (int i = 0; i < numBins; ++i)
     {
-        magnitude[i] = std::abs(fftBuffer[i]);
         phase[i] = std::arg(fftBuffer[i]);
     }
 
@@ -132,12 +301,12 @@ std::vector<float> STFT::inverse(const std::vector<float>& magnitude, const std:
     // Perform inverse FFT
     ifft(fftBuffer);
 
-    // Extract real part and apply window
-    std::vector<float> outputFrame(fftSize);
-    for (int i = 0; i < fftSize; ++i)
-    {
-        outputFrame[i] = fftBuffer[i].real() * window[i];
-    }
+    // Extract real part and apply synthesis window
+    // (asymmetric windows leave everything before the synthesis offset at zero)
+    std::vector<float> outputFrame(fftSize, 0.0f);
+    const int offset = getSynthesisOffset();
+    simd::realTimesWindow(fftBuffer.data() + offset, windows->synthesisWindow.data() + offset,
+                          outputFrame.data() + offset, fftSize - offset);
 
     return outputFrame;
 }
@@ -152,52 +321,12 @@ std::vector<float> STFT::getFrequencyBins() const
     return frequencies;
 }
 
-void STFT::bitReverse(std::vector<std::complex<float>>& x)
-{
-    int n = static_cast<int>(x.size());
-    int bits = 0;
-    while ((1 << bits) < n)
-        ++bits;
-
-    for (int i = 0; i < n; ++i)
-    {
-        int j = 0;
-        for (int b = 0; b < bits; ++b)
-        {
-            j |= ((i >> b) & 1) << (bits - 1 - b);
-        }
-        if (j > i)
-        {
-            std::swap(x[i], x[j]);
-        }
-    }
-}
-
 void STFT::fft(std::vector<std::complex<float>>& x)
 {
-    int n = static_cast<int>(x.size());
-
-    // Bit-reversal permutation
-    bitReverse(x);
-
-    // Cooley-Tukey iterative FFT
-    for (int size = 2; size <= n; size *= 2)
-    {
-        int halfSize = size / 2;
-        int step = n / size;
-
-        for (int i = 0; i < n; i += size)
-        {
-            for (int j = 0; j < halfSize; ++j)
-            {
-                auto& even = x[i + j];
-                auto& odd = x[i + j + halfSize];
-                auto t = twiddleFactors[j * step] * odd;
-                odd = even - t;
-                even = even + t;
-            }
-        }
-    }
+    if (fixedSizeKernel != nullptr)
+        fixedSizeKernel(x.data());
+    else
+        mixedRadixPlan->forward(x.data(), fftScratch.data());
 }
 
 void STFT::ifft(std::vector<std::complex<float>>& x)
@@ -4,6 +4,11 @@
 #include <complex>
 #include <cmath>
 #include <algorithm>
+#include <memory>
+#include "DspArena.h"
+#include "FixedSizeFFT.h"
+#include "MixedRadixFFT.h"
+#include "SharedTableCache.h"
 
 namespace fshift
 {
@@ -32,7 +37,7 @@ public:
     /**
      * Construct STFT processor.
      *
-     * @param fftSize FFT window size (must be power of 2)
+     * @param fftSize FFT window size (even, prime factors 2, 3 and 5 only)
      * @param hopSize Hop size between frames in samples
      * @param windowType Window function type
      */
@@ -50,6 +55,45 @@ public:
      */
     void reset();
 
+    /**
+     * Switch to asymmetric analysis/synthesis windows for low-latency processing.
+     *
+     * The analysis window keeps the full fftSize for frequency resolution but
+     * falls off over the last synthesisLength / 2 samples. The synthesis window
+     * is only non-zero over the last synthesisLength samples of the frame, so
+     * overlap-add latency drops from fftSize to synthesisLength. The synthesis
+     * window is normalized so analysis * synthesis overlap-adds to unity at the
+     * configured hop (perfect reconstruction).
+     *
+     * Based on Mauler & Martin, "A low delay, variable resolution, perfect
+     * reconstruction spectral analysis-synthesis system for speech enhancement".
+     *
+     * @param synthesisLength Synthesis window length in samples (even,
+     *                        2 * hopSize <= length < fftSize), or 0 for symmetric windows
+     */
+    void setAsymmetricWindows(int synthesisLength);
+
+    /**
+     * Enable reassignment-based instantaneous frequency estimation.
+     *
+     * forward() then also transforms the frame with the time-derivative of the
+     * analysis window and computes each bin's instantaneous frequency from
+     * Im(X_dh / X_h), which is unambiguous within a single frame (no reliance on
+     * heavy overlap). Both windowed frames are packed into one complex FFT, so
+     * the extra cost is only the split of the two spectra.
+     *
+     * Reference: Auger & Flandrin, "Improving the readability of time-frequency
+     * and time-scale representations by the reassignment method" (1995).
+     */
+    void setReassignmentEnabled(bool enabled) { reassignmentEnabled = enabled; }
+    bool isReassignmentEnabled() const { return reassignmentEnabled; }
+
+    /**
+     * Instantaneous frequency per bin (Hz) from the last forward() call.
+     * Only valid when reassignment is enabled.
+     */
+    const std::vector<float>& getReassignedFrequencies() const { return reassignedFrequencies; }
+
     /**
      * Perform forward STFT on an input frame.
      *
@@ -58,12 +102,25 @@ public:
      */
     std::pair<std::vector<float>, std::vector<float>> forward(const std::vector<float>& inputFrame);
 
+    /**
+     * Perform forward STFT on a frame read in place (e.g. a ring buffer window).
+     *
+     * @param inputFrame Time-domain samples
+     * @param numSamples Number of samples (must equal the FFT size)
+     * @return Pair of (magnitude, phase) vectors
+     */
+    std::pair<std::vector<float>, std::vector<float>> forward(const float* inputFrame, int numSamples);
+
     /**
      * Perform inverse STFT to reconstruct time-domain signal.
      *
+     * The synthesis window is COLA-normalized for the hop size, so plain
+     * overlap-add of successive frames reconstructs the input at unity gain.
+     *
      * @param magnitude Magnitude spectrum
      * @param phase Phase spectrum in radians
-     * @return Time-domain frame (fftSize samples)
+     * @return Time-domain frame (fftSize samples). With asymmetric windows only the
+     *         last getLatencySamples() samples are non-zero.
      */
     std::vector<float> inverse(const std::vector<float>& magnitude, const std::vector<float>& phase);
 
@@ -80,27 +137,92 @@ public:
     int getNumBins() const { return numBins; }
     double getSampleRate() const { return sampleRate; }
     float getBinResolution() const { return binResolution; }
+    bool isAsymmetric() const { return synthesisLength > 0; }
+
+    /** Overlap-add latency in samples: fftSize, or the synthesis length when asymmetric. */
+    int getLatencySamples() const { return synthesisLength > 0 ? synthesisLength : fftSize; }
+
+    /** Offset of the first non-zero synthesis sample within an output frame. */
+    int getSynthesisOffset() const { return fftSize - getLatencySamples(); }
+
+    /**
+     * Heap bytes owned by this instance (scratch buffers). Windows and twiddles
+     * are shared process-wide, see getSharedMemoryBytes().
+     */
+    size_t getMemoryBytes() const
+    {
+        return getVectorBytes(reassignedFrequencies) + getVectorBytes(fftBuffer) + getVectorBytes(fftScratch);
+    }
+
+    /**
+     * Bytes of the shared window tables and mixed-radix plan this instance references
+     * (specialized sizes keep their twiddles in static constexpr tables instead).
+     */
+    size_t getSharedMemoryBytes() const
+    {
+        return getVectorBytes(windows->window) + getVectorBytes(windows->synthesisWindow)
+             + getVectorBytes(windows->windowSquared) + getVectorBytes(windows->derivativeWindow)
+             + (mixedRadixPlan ? mixedRadixPlan->getMemoryBytes() : 0);
+    }
+
+    /** True if this size runs on a compile-time specialized FFT kernel. */
+    bool hasFixedSizeKernel() const { return fixedSizeKernel != nullptr; }
 
 private:
+    /**
+     * Analysis/synthesis windows for one (fftSize, hop, window type, synthesis length).
+     * Immutable once built and shared by every STFT with the same configuration.
+     */
+    struct WindowTables
+    {
+        std::vector<float> window;
+        std::vector<float> synthesisWindow;
+        std::vector<float> windowSquared;
+        std::vector<float> derivativeWindow;
+    };
+
+    /**
+     * Point `windows` at the shared tables for the current configuration.
+     */
+    void updateWindowTables();
+
+    /**
+     * Build the complete window set for a configuration.
+     */
+    static WindowTables buildWindowTables(int fftSize, int hopSize, WindowType windowType, int synthesisLength);
+
     /**
      * Create window function.
      */
-    void createWindow();
+    static void createWindow(WindowTables& tables, int fftSize, WindowType windowType);
 
     /**
-     * Perform FFT using Cooley-Tukey algorithm.
+     * Create asymmetric analysis/synthesis window pair for synthesisLength.
      */
-    void fft(std::vector<std::complex<float>>& x);
+    static void createAsymmetricWindows(WindowTables& tables, int fftSize, int synthesisLength);
 
     /**
-     * Perform inverse FFT.
+     * Divide the synthesis window by the overlap-added analysis * synthesis sum
+     * at each phase of the hop, so reconstruction gain is exactly 1 for any
+     * window and overlap factor.
      */
-    void ifft(std::vector<std::complex<float>>& x);
+    static void normalizeSynthesisWindow(WindowTables& tables, int fftSize, int hopSize);
 
     /**
-     * Bit-reversal permutation.
+     * Compute the time-derivative of the analysis window (per sample).
      */
-    void bitReverse(std::vector<std::complex<float>>& x);
+    static void createDerivativeWindow(WindowTables& tables, int fftSize, bool periodic);
+
+    /**
+     * Perform FFT: the fixed-size kernel when one exists, otherwise the
+     * mixed-radix plan.
+     */
+    void fft(std::vector<std::complex<float>>& x);
+
+    /**
+     * Perform inverse FFT.
+     */
+    void ifft(std::vector<std::complex<float>>& x);
 
     int fftSize;
     int hopSize;
@@ -109,12 +231,22 @@ private:
     double sampleRate;
     float binResolution;
 
-    std::vector<float> window;
-    std::vector<float> windowSquared;
+    int synthesisLength = 0;  // 0 = symmetric (synthesisWindow == window)
+
+    // Shared, read-only window set (see SharedTableCache)
+    std::shared_ptr<const WindowTables> windows;
+
+    // Reassignment (instantaneous frequency from derivative window)
+    bool reassignmentEnabled = false;
+    std::vector<float> reassignedFrequencies;
     std::vector<std::complex<float>> fftBuffer;
 
-    // Pre-computed twiddle factors for FFT
-    std::vector<std::complex<float>> twiddleFactors;
+    // Specialized transform for the plugin's power-of-two sizes (nullptr for other sizes)
+    FFTKernel fixedSizeKernel = nullptr;
+
+    // Mixed-radix plan for every other size (shared by all STFTs of this size)
+    std::shared_ptr<const MixedRadixFFT> mixedRadixPlan;
+    std::vector<std::complex<float>> fftScratch;
 };
 
 } // namespace fshift
@@ -4,6 +4,7 @@
 #include <string>
 #include <array>
 #include <cmath>
+#include <initializer_list>
 
 namespace fshift
 {
@@ -38,10 +39,35 @@ enum class ScaleType
     COUNT  // Keep last for iteration
 };
 
+/**
+ * Scale degrees (semitones from root) held inline, so copying a scale
+ * never touches the heap. Iterates like a container over the used degrees.
+ */
+struct ScaleDegrees
+{
+    static constexpr int MAX_DEGREES = 12;
+
+    constexpr ScaleDegrees() = default;
+
+    constexpr ScaleDegrees(std::initializer_list<int> list)
+    {
+        for (int degree : list)
+            if (count < MAX_DEGREES)
+                degrees[static_cast<size_t>(count++)] = degree;
+    }
+
+    constexpr const int* begin() const { return degrees.data(); }
+    constexpr const int* end() const { return degrees.data() + count; }
+    constexpr int size() const { return count; }
+
+    std::array<int, MAX_DEGREES> degrees {};
+    int count = 0;
+};
+
 /**
  * Get the scale degrees (semitones from root) for a given scale type.
  */
-inline std::vector<int> getScaleDegrees(ScaleType type)
+constexpr ScaleDegrees getScaleDegrees(ScaleType type)
 {
     switch (type)
     {
@@ -200,7 +226,7 @@ inline float midiToFreq(float midi, float a4Freq = 440.0f)
  * @param scaleDegrees Scale degrees (semitones from root)
  * @return Quantized MIDI note number (integer)
  */
-inline int quantizeToScale(float midiNote, int rootMidi, const std::vector<int>& scaleDegrees)
+inline int quantizeToScale(float midiNote, int rootMidi, const ScaleDegrees& scaleDegrees)
 {
     // Calculate relative note within octave
     float relativeNote = std::fmod(midiNote - static_cast<float>(rootMidi), 12.0f);
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace fshift
+{
+
+/**
+ * SharedTableCache - Process-wide cache of immutable, read-only DSP tables.
+ *
+ * Windows, twiddles and bin tables depend only on a few parameters (FFT size,
+ * hop, window type, sample rate), so every plugin instance and every channel
+ * with the same configuration can share one copy instead of building its own.
+ *
+ * get() returns a shared_ptr<const Table>; the cache itself only holds weak
+ * references, so a table is freed when the last user lets go of it and is
+ * rebuilt on the next request. Lookups and builds are serialized by one mutex
+ * per table type. Only call get() where the DSP objects are (re)constructed,
+ * never per block: the hot path just dereferences the pointer it already holds.
+ *
+ * @tparam Key   Ordered key type (e.g. a std::tuple of the table parameters)
+ * @tparam Table Table type, built once per distinct key
+ */
+template <typename Key, typename Table>
+class SharedTableCache
+{
+public:
+    /**
+     * Get the table for `key`, calling build() to create it if no live copy exists.
+     * @param build Callable returning a Table by value
+     */
+    template <typename Builder>
+    static std::shared_ptr<const Table> get(const Key& key, Builder&& build)
+    {
+        auto& state = getState();
+        const std::lock_guard<std::mutex> lock(state.mutex);
+
+        auto it = state.entries.find(key);
+        if (it != state.entries.end())
+        {
+            if (auto existing = it->second.lock())
+                return existing;
+        }
+
+        // Drop entries whose tables have all been released
+        for (auto e = state.entries.begin(); e != state.entries.end();)
+            e = e->second.expired() ? state.entries.erase(e) : std::next(e);
+
+        auto table = std::make_shared<const Table>(build());
+        state.entries[key] = table;
+        return table;
+    }
+
+    /** Number of distinct tables currently alive (for diagnostics). */
+    static size_t getNumLiveTables()
+    {
+        auto& state = getState();
+        const std::lock_guard<std::mutex> lock(state.mutex);
+
+        size_t live = 0;
+        for (const auto& entry : state.entries)
+            live += entry.second.expired() ? 0 : 1;
+        return live;
+    }
+
+private:
+    struct State
+    {
+        std::mutex mutex;
+        std::map<Key, std::weak_ptr<const Table>> entries;
+    };
+
+    static State& getState()
+    {
+        static State state;
+        return state;
+    }
+};
+
+} // namespace fshift
@@ -0,0 +1,212 @@
+#include "SimdKernelsImpl.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#if FSHIFT_SIMD_X86 && defined(_MSC_VER) && !defined(__clang__)
+    #include <immintrin.h>
+    #include <intrin.h>
+#endif
+
+namespace fshift
+{
+namespace simd
+{
+namespace scalar
+{
+
+void add(float* dst, const float* src, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+        dst[i] += src[i];
+}
+
+void scale(float* dst, float gain, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+        dst[i] *= gain;
+}
+
+float sumOfSquares(const float* src, int numSamples)
+{
+    float sum = 0.0f;
+    for (int i = 0; i < numSamples; ++i)
+        sum += src[i] * src[i];
+    return sum;
+}
+
+void windowToComplex(const float* src, const float* realWindow, const float* imagWindow,
+                     std::complex<float>* dst, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+        dst[i] = std::complex<float>(src[i] * realWindow[i], imagWindow != nullptr ? src[i] * imagWindow[i] : 0.0f);
+}
+
+void complexMagnitude(const std::complex<float>* src, float* dst, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+        dst[i] = std::abs(src[i]);
+}
+
+void realTimesWindow(const std::complex<float>* src, const float* window, float* dst, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+        dst[i] = src[i].real() * window[i];
+}
+
+void blend(float* wet, const float* dry, const float* mask, int maskStride, int numBins)
+{
+    for (int i = 0; i < numBins; ++i)
+    {
+        const float m = mask[static_cast<size_t>(i) * static_cast<size_t>(maskStride)];
+        wet[i] = wet[i] * m + dry[i] * (1.0f - m);
+    }
+}
+
+void smooth3(const float* src, float* dst, int numBins)
+{
+    if (numBins <= 0)
+        return;
+    if (numBins < 3)
+    {
+        std::copy(src, src + numBins, dst);
+        return;
+    }
+
+    dst[0] = src[0];
+    for (int k = 1; k < numBins - 1; ++k)
+        dst[k] = 0.25f * src[k - 1] + 0.50f * src[k] + 0.25f * src[k + 1];
+    dst[numBins - 1] = src[numBins - 1];
+}
+
+void gainToNormalizedDb(const float* src, float* dst, float rangeDb, int numBins)
+{
+    for (int i = 0; i < numBins; ++i)
+    {
+        const float db = src[i] > 0.0f ? std::max(-rangeDb, 20.0f * std::log10(src[i])) : -rangeDb;
+        dst[i] = std::clamp((db + rangeDb) / rangeDb, 0.0f, 1.0f);
+    }
+}
+
+} // namespace scalar
+
+namespace
+{
+
+const KernelTable scalarKernels = {
+    InstructionSet::Scalar,
+    &scalar::add,
+    &scalar::scale,
+    &scalar::sumOfSquares,
+    &scalar::windowToComplex,
+    &scalar::complexMagnitude,
+    &scalar::realTimesWindow,
+    &scalar::blend,
+    &scalar::smooth3,
+    &scalar::gainToNormalizedDb
+};
+
+const KernelTable* getTable(InstructionSet instructionSet)
+{
+    switch (instructionSet)
+    {
+        case InstructionSet::Scalar:  return &scalarKernels;
+        case InstructionSet::SSE2:    return detail::getSse2Kernels();
+        case InstructionSet::AVX2:    return detail::getAvx2Kernels();
+        case InstructionSet::AVX512:  return detail::getAvx512Kernels();
+        case InstructionSet::NEON:    return detail::getNeonKernels();
+    }
+    return nullptr;
+}
+
+#if FSHIFT_SIMD_X86 && defined(_MSC_VER) && !defined(__clang__)
+// CPUID leaf 7 / XCR0 checks (the OS must also save the wider registers)
+InstructionSet detectX86WithCpuid()
+{
+    int info[4] = {};
+    __cpuid(info, 1);
+    const bool hasSse2 = (info[3] & (1 << 26)) != 0;
+    const bool hasFma = (info[2] & (1 << 12)) != 0;
+    const bool hasOsxsave = (info[2] & (1 << 27)) != 0;
+    const bool hasAvx = (info[2] & (1 << 28)) != 0;
+
+    const unsigned long long xcr0 = hasOsxsave ? _xgetbv(0) : 0;
+    const bool osSavesYmm = (xcr0 & 0x6) == 0x6;
+    const bool osSavesZmm = (xcr0 & 0xe6) == 0xe6;
+
+    __cpuidex(info, 7, 0);
+    const bool hasAvx2 = (info[1] & (1 << 5)) != 0;
+    const bool hasAvx512f = (info[1] & (1 << 16)) != 0;
+
+    if (hasAvx512f && osSavesZmm)
+        return InstructionSet::AVX512;
+    if (hasAvx && hasAvx2 && hasFma && osSavesYmm)
+        return InstructionSet::AVX2;
+    return hasSse2 ? InstructionSet::SSE2 : InstructionSet::Scalar;
+}
+#endif
+
+std::atomic<const KernelTable*>& getActiveTable()
+{
+    static std::atomic<const KernelTable*> active{ getTable(detectInstructionSet()) };
+    return active;
+}
+
+} // namespace
+
+InstructionSet detectInstructionSet()
+{
+#if FSHIFT_SIMD_X86 && defined(_MSC_VER) && !defined(__clang__)
+    return detectX86WithCpuid();
+#elif FSHIFT_SIMD_X86
+    // __builtin_cpu_supports also checks that the OS saves the wider registers
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return InstructionSet::AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return InstructionSet::AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return InstructionSet::SSE2;
+    return InstructionSet::Scalar;
+#elif FSHIFT_SIMD_NEON
+    return InstructionSet::NEON;  // Mandatory on AArch64
+#else
+    return InstructionSet::Scalar;
+#endif
+}
+
+const KernelTable& getKernels()
+{
+    return *getActiveTable().load(std::memory_order_relaxed);
+}
+
+bool setInstructionSet(InstructionSet instructionSet)
+{
+    const InstructionSet best = detectInstructionSet();
+    bool supported = instructionSet == InstructionSet::Scalar || instructionSet == best;
+    if (best != InstructionSet::NEON && instructionSet != InstructionSet::NEON)
+        supported = supported || instructionSet < best;   // x86 sets are ordered
+
+    const KernelTable* table = supported ? getTable(instructionSet) : nullptr;
+    if (table == nullptr)
+        return false;
+
+    getActiveTable().store(table, std::memory_order_relaxed);
+    return true;
+}
+
+const char* getInstructionSetName(InstructionSet instructionSet)
+{
+    switch (instructionSet)
+    {
+        case InstructionSet::Scalar:  return "Scalar";
+        case InstructionSet::SSE2:    return "SSE2";
+        case InstructionSet::AVX2:    return "AVX2";
+        case InstructionSet::AVX512:  return "AVX-512";
+        case InstructionSet::NEON:    return "NEON";
+    }
+    return "Unknown";
+}
+
+} // namespace simd
+} // namespace fshift
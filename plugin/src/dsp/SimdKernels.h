@@ -0,0 +1,136 @@
+#pragma once
+
+#include <complex>
+
+namespace fshift
+{
+namespace simd
+{
+
+/**
+ * Instruction sets with a kernel implementation, in order of preference per architecture.
+ */
+enum class InstructionSet
+{
+    Scalar,     // Portable reference implementation
+    SSE2,       // x86 baseline
+    AVX2,       // x86 with AVX2 + FMA
+    AVX512,     // x86 with AVX-512F
+    NEON        // AArch64
+};
+
+/**
+ * KernelTable - Function pointers for the per-bin spectral inner loops.
+ *
+ * One table exists per instruction set. The best one the CPU supports is
+ * chosen once (CPUID on x86) and then used for every call, so a single binary
+ * runs the widest kernels available on each machine. All pointers are
+ * unaligned-safe and handle any length; lengths <= 0 are a no-op.
+ */
+struct KernelTable
+{
+    InstructionSet instructionSet;
+
+    /** dst[i] += src[i] (overlap-add). */
+    void (*add)(float* dst, const float* src, int numSamples);
+
+    /** dst[i] *= gain. */
+    void (*scale)(float* dst, float gain, int numSamples);
+
+    /** Sum of src[i]^2 (spectral energy). */
+    float (*sumOfSquares)(const float* src, int numSamples);
+
+    /**
+     * dst[i] = (src[i] * realWindow[i], src[i] * imagWindow[i]); imaginary part 0
+     * when imagWindow is nullptr (STFT analysis windowing).
+     */
+    void (*windowToComplex)(const float* src, const float* realWindow, const float* imagWindow,
+                            std::complex<float>* dst, int numSamples);
+
+    /** dst[i] = |src[i]|. */
+    void (*complexMagnitude)(const std::complex<float>* src, float* dst, int numSamples);
+
+    /** dst[i] = src[i].real() * window[i] (STFT synthesis windowing). */
+    void (*realTimesWindow)(const std::complex<float>* src, const float* window, float* dst, int numSamples);
+
+    /** wet[i] = wet[i] * mask[i * maskStride] + dry[i] * (1 - mask[i * maskStride]). */
+    void (*blend)(float* wet, const float* dry, const float* mask, int maskStride, int numBins);
+
+    /** 3-tap [0.25, 0.5, 0.25] smoothing; the first and last bins are copied. */
+    void (*smooth3)(const float* src, float* dst, int numBins);
+
+    /**
+     * dst[i] = clamp((gainToDecibels(src[i]) + rangeDb) / rangeDb, 0, 1), i.e. 0 at
+     * -rangeDb and 1 at 0 dB (analyzer display). Vector versions use a log
+     * approximation accurate to ~1e-3 dB.
+     */
+    void (*gainToNormalizedDb)(const float* src, float* dst, float rangeDb, int numBins);
+};
+
+/** Kernel table in use (selected on first call). */
+const KernelTable& getKernels();
+
+/** Widest instruction set this CPU supports. */
+InstructionSet detectInstructionSet();
+
+/** Instruction set of the table in use. */
+inline InstructionSet getActiveInstructionSet() { return getKernels().instructionSet; }
+
+/**
+ * Switch to another table, e.g. the scalar reference for comparisons or
+ * benchmarks. Returns false (and changes nothing) if the CPU or build lacks it.
+ */
+bool setInstructionSet(InstructionSet instructionSet);
+
+const char* getInstructionSetName(InstructionSet instructionSet);
+
+// Convenience wrappers over the active table
+
+inline void add(float* dst, const float* src, int numSamples)
+{
+    getKernels().add(dst, src, numSamples);
+}
+
+inline void scale(float* dst, float gain, int numSamples)
+{
+    getKernels().scale(dst, gain, numSamples);
+}
+
+inline float sumOfSquares(const float* src, int numSamples)
+{
+    return getKernels().sumOfSquares(src, numSamples);
+}
+
+inline void windowToComplex(const float* src, const float* realWindow, const float* imagWindow,
+                            std::complex<float>* dst, int numSamples)
+{
+    getKernels().windowToComplex(src, realWindow, imagWindow, dst, numSamples);
+}
+
+inline void complexMagnitude(const std::complex<float>* src, float* dst, int numSamples)
+{
+    getKernels().complexMagnitude(src, dst, numSamples);
+}
+
+inline void realTimesWindow(const std::complex<float>* src, const float* window, float* dst, int numSamples)
+{
+    getKernels().realTimesWindow(src, window, dst, numSamples);
+}
+
+inline void blend(float* wet, const float* dry, const float* mask, int maskStride, int numBins)
+{
+    getKernels().blend(wet, dry, mask, maskStride, numBins);
+}
+
+inline void smooth3(const float* src, float* dst, int numBins)
+{
+    getKernels().smooth3(src, dst, numBins);
+}
+
+inline void gainToNormalizedDb(const float* src, float* dst, float rangeDb, int numBins)
+{
+    getKernels().gainToNormalizedDb(src, dst, rangeDb, numBins);
+}
+
+} // namespace simd
+} // namespace fshift
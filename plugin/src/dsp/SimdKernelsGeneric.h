@@ -0,0 +1,171 @@
+// Deliberately no #pragma once: this file is included once per instruction set,
+// inside that set's namespace and target region, after the `Ops` struct for the
+// set has been defined. Every function here is therefore compiled for that target.
+//
+// Ops provides: V, width, load, store, set1, zero, add, sub, mul, fmadd (a * b + c),
+// min, max, div, sqrt, reduceAdd, loadStrided, loadComplex (deinterleave),
+// storeComplex (interleave), exponent and mantissa (of a positive normal value,
+// mantissa in [1, 2)).
+
+struct GenericKernels
+{
+    using V = Ops::V;
+    static constexpr int W = Ops::width;
+
+    static void add(float* dst, const float* src, int numSamples)
+    {
+        int i = 0;
+        for (; i + W <= numSamples; i += W)
+            Ops::store(dst + i, Ops::add(Ops::load(dst + i), Ops::load(src + i)));
+        scalar::add(dst + i, src + i, numSamples - i);
+    }
+
+    static void scale(float* dst, float gain, int numSamples)
+    {
+        const V g = Ops::set1(gain);
+        int i = 0;
+        for (; i + W <= numSamples; i += W)
+            Ops::store(dst + i, Ops::mul(Ops::load(dst + i), g));
+        scalar::scale(dst + i, gain, numSamples - i);
+    }
+
+    static float sumOfSquares(const float* src, int numSamples)
+    {
+        V sum = Ops::zero();
+        int i = 0;
+        for (; i + W <= numSamples; i += W)
+        {
+            const V x = Ops::load(src + i);
+            sum = Ops::fmadd(x, x, sum);
+        }
+        return Ops::reduceAdd(sum) + scalar::sumOfSquares(src + i, numSamples - i);
+    }
+
+    static void windowToComplex(const float* src, const float* realWindow, const float* imagWindow,
+                                std::complex<float>* dst, int numSamples)
+    {
+        float* out = reinterpret_cast<float*>(dst);
+        int i = 0;
+        for (; i + W <= numSamples; i += W)
+        {
+            const V x = Ops::load(src + i);
+            const V re = Ops::mul(x, Ops::load(realWindow + i));
+            const V im = imagWindow != nullptr ? Ops::mul(x, Ops::load(imagWindow + i)) : Ops::zero();
+            Ops::storeComplex(out + 2 * i, re, im);
+        }
+        scalar::windowToComplex(src + i, realWindow + i, imagWindow != nullptr ? imagWindow + i : nullptr,
+                                dst + i, numSamples - i);
+    }
+
+    static void complexMagnitude(const std::complex<float>* src, float* dst, int numSamples)
+    {
+        const float* in = reinterpret_cast<const float*>(src);
+        int i = 0;
+        for (; i + W <= numSamples; i += W)
+        {
+            V re, im;
+            Ops::loadComplex(in + 2 * i, re, im);
+            Ops::store(dst + i, Ops::sqrt(Ops::fmadd(re, re, Ops::mul(im, im))));
+        }
+        scalar::complexMagnitude(src + i, dst + i, numSamples - i);
+    }
+
+    static void realTimesWindow(const std::complex<float>* src, const float* window, float* dst, int numSamples)
+    {
+        const float* in = reinterpret_cast<const float*>(src);
+        int i = 0;
+        for (; i + W <= numSamples; i += W)
+        {
+            V re, im;
+            Ops::loadComplex(in + 2 * i, re, im);
+            Ops::store(dst + i, Ops::mul(re, Ops::load(window + i)));
+        }
+        scalar::realTimesWindow(src + i, window + i, dst + i, numSamples - i);
+    }
+
+    static void blend(float* wet, const float* dry, const float* mask, int maskStride, int numBins)
+    {
+        const V one = Ops::set1(1.0f);
+        int i = 0;
+        for (; i + W <= numBins; i += W)
+        {
+            const V m = maskStride == 1 ? Ops::load(mask + i)
+                                        : Ops::loadStrided(mask + static_cast<size_t>(i) * static_cast<size_t>(maskStride), maskStride);
+            const V blended = Ops::fmadd(Ops::load(wet + i), m, Ops::mul(Ops::load(dry + i), Ops::sub(one, m)));
+            Ops::store(wet + i, blended);
+        }
+        scalar::blend(wet + i, dry + i, mask + static_cast<size_t>(i) * static_cast<size_t>(maskStride),
+                      maskStride, numBins - i);
+    }
+
+    static void smooth3(const float* src, float* dst, int numBins)
+    {
+        if (numBins < 3)
+        {
+            scalar::smooth3(src, dst, numBins);
+            return;
+        }
+
+        const V quarter = Ops::set1(0.25f);
+        const V half = Ops::set1(0.5f);
+        dst[0] = src[0];
+
+        int k = 1;
+        for (; k + W <= numBins - 1; k += W)
+        {
+            const V outer = Ops::add(Ops::load(src + k - 1), Ops::load(src + k + 1));
+            Ops::store(dst + k, Ops::fmadd(outer, quarter, Ops::mul(Ops::load(src + k), half)));
+        }
+        for (; k < numBins - 1; ++k)
+            dst[k] = 0.25f * src[k - 1] + 0.50f * src[k] + 0.25f * src[k + 1];
+
+        dst[numBins - 1] = src[numBins - 1];
+    }
+
+    static void gainToNormalizedDb(const float* src, float* dst, float rangeDb, int numBins)
+    {
+        // log2(x) = exponent + log2(mantissa), with log2(m) = 2/ln2 * atanh((m - 1) / (m + 1))
+        // as an odd series in t = (m - 1) / (m + 1), |t| < 1/3
+        const V tiny = Ops::set1(1.0e-30f);
+        const V one = Ops::set1(1.0f);
+        const V zero = Ops::zero();
+        const V c1 = Ops::set1(2.8853900818f);
+        const V c3 = Ops::set1(0.9617966939f);
+        const V c5 = Ops::set1(0.5770780164f);
+        const V c7 = Ops::set1(0.4121985831f);
+        const V dbPerOctave = Ops::set1(6.0205999133f);   // 20 * log10(2)
+        const V invRange = Ops::set1(1.0f / rangeDb);
+
+        int i = 0;
+        for (; i + W <= numBins; i += W)
+        {
+            const V x = Ops::max(Ops::load(src + i), tiny);
+            const V m = Ops::mantissa(x);
+            const V t = Ops::div(Ops::sub(m, one), Ops::add(m, one));
+            const V t2 = Ops::mul(t, t);
+            V poly = Ops::fmadd(t2, c7, c5);
+            poly = Ops::fmadd(t2, poly, c3);
+            poly = Ops::fmadd(t2, poly, c1);
+            const V log2x = Ops::fmadd(t, poly, Ops::exponent(x));
+
+            // (dB + range) / range, clamped to [0, 1]
+            const V normalized = Ops::fmadd(Ops::mul(log2x, dbPerOctave), invRange, one);
+            Ops::store(dst + i, Ops::min(Ops::max(normalized, zero), one));
+        }
+        scalar::gainToNormalizedDb(src + i, dst + i, rangeDb, numBins - i);
+    }
+};
+
+inline KernelTable makeKernelTable(InstructionSet instructionSet)
+{
+    return { instructionSet,
+             &GenericKernels::add,
+             &GenericKernels::scale,
+             &GenericKernels::sumOfSquares,
+             &GenericKernels::windowToComplex,
+             &GenericKernels::complexMagnitude,
+             &GenericKernels::realTimesWindow,
+             &GenericKernels::blend,
+             &GenericKernels::smooth3,
+             &GenericKernels::gainToNormalizedDb };
+}
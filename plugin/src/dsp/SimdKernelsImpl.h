@@ -0,0 +1,51 @@
+#pragma once
+
+#include "SimdKernels.h"
+
+// Internal to the SimdKernels*.cpp files.
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define FSHIFT_SIMD_X86 1
+#else
+    #define FSHIFT_SIMD_X86 0
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+    #define FSHIFT_SIMD_NEON 1
+#else
+    #define FSHIFT_SIMD_NEON 0
+#endif
+
+namespace fshift
+{
+namespace simd
+{
+namespace scalar
+{
+
+// Reference implementations; the vector kernels also use them for tails.
+void add(float* dst, const float* src, int numSamples);
+void scale(float* dst, float gain, int numSamples);
+float sumOfSquares(const float* src, int numSamples);
+void windowToComplex(const float* src, const float* realWindow, const float* imagWindow,
+                     std::complex<float>* dst, int numSamples);
+void complexMagnitude(const std::complex<float>* src, float* dst, int numSamples);
+void realTimesWindow(const std::complex<float>* src, const float* window, float* dst, int numSamples);
+void blend(float* wet, const float* dry, const float* mask, int maskStride, int numBins);
+void smooth3(const float* src, float* dst, int numBins);
+void gainToNormalizedDb(const float* src, float* dst, float rangeDb, int numBins);
+
+} // namespace scalar
+
+namespace detail
+{
+
+// Tables defined by the per-architecture translation units (nullptr if not built)
+const KernelTable* getSse2Kernels();
+const KernelTable* getAvx2Kernels();
+const KernelTable* getAvx512Kernels();
+const KernelTable* getNeonKernels();
+
+} // namespace detail
+} // namespace simd
+} // namespace fshift
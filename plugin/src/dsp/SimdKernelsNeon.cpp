@@ -0,0 +1,105 @@
+#include "SimdKernelsImpl.h"
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+
+// NEON kernels (AArch64, where NEON and the vector sqrt/div are always present).
+
+#if FSHIFT_SIMD_NEON
+
+#include <arm_neon.h>
+
+namespace fshift
+{
+namespace simd
+{
+namespace neon
+{
+
+struct Ops
+{
+    using V = float32x4_t;
+    static constexpr int width = 4;
+
+    static V load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, V v) { vst1q_f32(p, v); }
+    static V set1(float x) { return vdupq_n_f32(x); }
+    static V zero() { return vdupq_n_f32(0.0f); }
+    static V add(V a, V b) { return vaddq_f32(a, b); }
+    static V sub(V a, V b) { return vsubq_f32(a, b); }
+    static V mul(V a, V b) { return vmulq_f32(a, b); }
+    static V fmadd(V a, V b, V c) { return vfmaq_f32(c, a, b); }
+    static V min(V a, V b) { return vminq_f32(a, b); }
+    static V max(V a, V b) { return vmaxq_f32(a, b); }
+    static V div(V a, V b) { return vdivq_f32(a, b); }
+    static V sqrt(V a) { return vsqrtq_f32(a); }
+    static float reduceAdd(V v) { return vaddvq_f32(v); }
+
+    static V loadStrided(const float* p, int stride)
+    {
+        const size_t s = static_cast<size_t>(stride);
+        const float lanes[4] = { p[0], p[s], p[2 * s], p[3 * s] };
+        return vld1q_f32(lanes);
+    }
+
+    static void loadComplex(const float* p, V& re, V& im)
+    {
+        const float32x4x2_t pair = vld2q_f32(p);
+        re = pair.val[0];
+        im = pair.val[1];
+    }
+
+    static void storeComplex(float* p, V re, V im)
+    {
+        float32x4x2_t pair;
+        pair.val[0] = re;
+        pair.val[1] = im;
+        vst2q_f32(p, pair);
+    }
+
+    static V exponent(V x)
+    {
+        const int32x4_t bits = vshrq_n_s32(vreinterpretq_s32_f32(x), 23);
+        return vcvtq_f32_s32(vsubq_s32(bits, vdupq_n_s32(127)));
+    }
+
+    static V mantissa(V x)
+    {
+        const uint32x4_t bits = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x007fffff));
+        return vreinterpretq_f32_u32(vorrq_u32(bits, vdupq_n_u32(0x3f800000)));
+    }
+};
+
+#include "SimdKernelsGeneric.h"
+
+} // namespace neon
+
+namespace detail
+{
+
+const KernelTable* getNeonKernels()
+{
+    static const KernelTable table = neon::makeKernelTable(InstructionSet::NEON);
+    return &table;
+}
+
+} // namespace detail
+} // namespace simd
+} // namespace fshift
+
+#else
+
+namespace fshift
+{
+namespace simd
+{
+namespace detail
+{
+
+const KernelTable* getNeonKernels() { return nullptr; }
+
+} // namespace detail
+} // namespace simd
+} // namespace fshift
+
+#endif
@@ -0,0 +1,297 @@
+#include "SimdKernelsImpl.h"
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+
+// SSE2, AVX2 and AVX-512 kernels. Each set is compiled through a target region
+// rather than per-file compiler flags, so this file builds unchanged inside a
+// universal (arm64 + x86_64) macOS build and without raising the baseline ISA.
+// Nothing here runs unless detectInstructionSet() found the set on this CPU.
+
+#if FSHIFT_SIMD_X86
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+    #define FSHIFT_TARGET_BEGIN_SSE2    _Pragma("clang attribute push(__attribute__((target(\"sse2\"))), apply_to = function)")
+    #define FSHIFT_TARGET_BEGIN_AVX2    _Pragma("clang attribute push(__attribute__((target(\"avx2,fma\"))), apply_to = function)")
+    #define FSHIFT_TARGET_BEGIN_AVX512  _Pragma("clang attribute push(__attribute__((target(\"avx512f,avx2,fma\"))), apply_to = function)")
+    #define FSHIFT_TARGET_END           _Pragma("clang attribute pop")
+    #define FSHIFT_AVX512_WARNINGS_BEGIN
+    #define FSHIFT_AVX512_WARNINGS_END
+#elif defined(__GNUC__)
+    #define FSHIFT_TARGET_BEGIN_SSE2    _Pragma("GCC push_options") _Pragma("GCC target(\"sse2\")")
+    #define FSHIFT_TARGET_BEGIN_AVX2    _Pragma("GCC push_options") _Pragma("GCC target(\"avx2,fma\")")
+    #define FSHIFT_TARGET_BEGIN_AVX512  _Pragma("GCC push_options") _Pragma("GCC target(\"avx512f,avx2,fma\")")
+    #define FSHIFT_TARGET_END           _Pragma("GCC pop_options")
+
+    // GCC 12's AVX-512 headers trip -Wuninitialized on _mm512_undefined_ps() (GCC PR 105593)
+    #define FSHIFT_AVX512_WARNINGS_BEGIN _Pragma("GCC diagnostic push") \
+                                         _Pragma("GCC diagnostic ignored \"-Wuninitialized\"") \
+                                         _Pragma("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+    #define FSHIFT_AVX512_WARNINGS_END   _Pragma("GCC diagnostic pop")
+#else
+    // MSVC compiles any intrinsic without per-function targets
+    #define FSHIFT_TARGET_BEGIN_SSE2
+    #define FSHIFT_TARGET_BEGIN_AVX2
+    #define FSHIFT_TARGET_BEGIN_AVX512
+    #define FSHIFT_TARGET_END
+    #define FSHIFT_AVX512_WARNINGS_BEGIN
+    #define FSHIFT_AVX512_WARNINGS_END
+#endif
+
+namespace fshift
+{
+namespace simd
+{
+
+//==============================================================================
+FSHIFT_TARGET_BEGIN_SSE2
+namespace sse2
+{
+
+struct Ops
+{
+    using V = __m128;
+    static constexpr int width = 4;
+
+    static V load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, V v) { _mm_storeu_ps(p, v); }
+    static V set1(float x) { return _mm_set1_ps(x); }
+    static V zero() { return _mm_setzero_ps(); }
+    static V add(V a, V b) { return _mm_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm_sub_ps(a, b); }
+    static V mul(V a, V b) { return _mm_mul_ps(a, b); }
+    static V fmadd(V a, V b, V c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static V min(V a, V b) { return _mm_min_ps(a, b); }
+    static V max(V a, V b) { return _mm_max_ps(a, b); }
+    static V div(V a, V b) { return _mm_div_ps(a, b); }
+    static V sqrt(V a) { return _mm_sqrt_ps(a); }
+
+    static float reduceAdd(V v)
+    {
+        const V pairs = _mm_add_ps(v, _mm_movehl_ps(v, v));
+        return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, 1)));
+    }
+
+    static V loadStrided(const float* p, int stride)
+    {
+        const size_t s = static_cast<size_t>(stride);
+        return _mm_setr_ps(p[0], p[s], p[2 * s], p[3 * s]);
+    }
+
+    static void loadComplex(const float* p, V& re, V& im)
+    {
+        const V a = _mm_loadu_ps(p);
+        const V b = _mm_loadu_ps(p + 4);
+        re = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        im = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    static void storeComplex(float* p, V re, V im)
+    {
+        _mm_storeu_ps(p, _mm_unpacklo_ps(re, im));
+        _mm_storeu_ps(p + 4, _mm_unpackhi_ps(re, im));
+    }
+
+    static V exponent(V x)
+    {
+        const __m128i bits = _mm_srli_epi32(_mm_castps_si128(x), 23);
+        return _mm_cvtepi32_ps(_mm_sub_epi32(bits, _mm_set1_epi32(127)));
+    }
+
+    static V mantissa(V x)
+    {
+        const __m128i bits = _mm_and_si128(_mm_castps_si128(x), _mm_set1_epi32(0x007fffff));
+        return _mm_castsi128_ps(_mm_or_si128(bits, _mm_set1_epi32(0x3f800000)));
+    }
+};
+
+#include "SimdKernelsGeneric.h"
+
+} // namespace sse2
+FSHIFT_TARGET_END
+
+//==============================================================================
+FSHIFT_TARGET_BEGIN_AVX2
+namespace avx2
+{
+
+struct Ops
+{
+    using V = __m256;
+    static constexpr int width = 8;
+
+    static V load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, V v) { _mm256_storeu_ps(p, v); }
+    static V set1(float x) { return _mm256_set1_ps(x); }
+    static V zero() { return _mm256_setzero_ps(); }
+    static V add(V a, V b) { return _mm256_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+    static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+    static V fmadd(V a, V b, V c) { return _mm256_fmadd_ps(a, b, c); }
+    static V min(V a, V b) { return _mm256_min_ps(a, b); }
+    static V max(V a, V b) { return _mm256_max_ps(a, b); }
+    static V div(V a, V b) { return _mm256_div_ps(a, b); }
+    static V sqrt(V a) { return _mm256_sqrt_ps(a); }
+
+    static float reduceAdd(V v)
+    {
+        __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        return _mm_cvtss_f32(_mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1)));
+    }
+
+    static V loadStrided(const float* p, int stride)
+    {
+        const __m256i index = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(stride));
+        return _mm256_i32gather_ps(p, index, 4);
+    }
+
+    static void loadComplex(const float* p, V& re, V& im)
+    {
+        // Per-lane shuffles give [0 1 4 5 | 2 3 6 7]; a 64-bit permute restores the order
+        const V a = _mm256_loadu_ps(p);
+        const V b = _mm256_loadu_ps(p + 8);
+        const V evens = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        const V odds = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        re = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(evens), _MM_SHUFFLE(3, 1, 2, 0)));
+        im = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(odds), _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+
+    static void storeComplex(float* p, V re, V im)
+    {
+        const V low = _mm256_unpacklo_ps(re, im);
+        const V high = _mm256_unpackhi_ps(re, im);
+        _mm256_storeu_ps(p, _mm256_permute2f128_ps(low, high, 0x20));
+        _mm256_storeu_ps(p + 8, _mm256_permute2f128_ps(low, high, 0x31));
+    }
+
+    static V exponent(V x)
+    {
+        const __m256i bits = _mm256_srli_epi32(_mm256_castps_si256(x), 23);
+        return _mm256_cvtepi32_ps(_mm256_sub_epi32(bits, _mm256_set1_epi32(127)));
+    }
+
+    static V mantissa(V x)
+    {
+        const __m256i bits = _mm256_and_si256(_mm256_castps_si256(x), _mm256_set1_epi32(0x007fffff));
+        return _mm256_castsi256_ps(_mm256_or_si256(bits, _mm256_set1_epi32(0x3f800000)));
+    }
+};
+
+#include "SimdKernelsGeneric.h"
+
+} // namespace avx2
+FSHIFT_TARGET_END
+
+//==============================================================================
+FSHIFT_AVX512_WARNINGS_BEGIN
+FSHIFT_TARGET_BEGIN_AVX512
+namespace avx512
+{
+
+struct Ops
+{
+    using V = __m512;
+    static constexpr int width = 16;
+
+    static V load(const float* p) { return _mm512_loadu_ps(p); }
+    static void store(float* p, V v) { _mm512_storeu_ps(p, v); }
+    static V set1(float x) { return _mm512_set1_ps(x); }
+    static V zero() { return _mm512_setzero_ps(); }
+    static V add(V a, V b) { return _mm512_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm512_sub_ps(a, b); }
+    static V mul(V a, V b) { return _mm512_mul_ps(a, b); }
+    static V fmadd(V a, V b, V c) { return _mm512_fmadd_ps(a, b, c); }
+    static V min(V a, V b) { return _mm512_min_ps(a, b); }
+    static V max(V a, V b) { return _mm512_max_ps(a, b); }
+    static V div(V a, V b) { return _mm512_div_ps(a, b); }
+    static V sqrt(V a) { return _mm512_sqrt_ps(a); }
+    static float reduceAdd(V v) { return _mm512_reduce_add_ps(v); }
+
+    static V loadStrided(const float* p, int stride)
+    {
+        const __m512i index = _mm512_mullo_epi32(
+            _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(stride));
+        return _mm512_i32gather_ps(index, p, 4);
+    }
+
+    static void loadComplex(const float* p, V& re, V& im)
+    {
+        const V a = _mm512_loadu_ps(p);
+        const V b = _mm512_loadu_ps(p + 16);
+        const __m512i evens = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+        const __m512i odds = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+        re = _mm512_permutex2var_ps(a, evens, b);
+        im = _mm512_permutex2var_ps(a, odds, b);
+    }
+
+    static void storeComplex(float* p, V re, V im)
+    {
+        const __m512i low = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+        const __m512i high = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+        _mm512_storeu_ps(p, _mm512_permutex2var_ps(re, low, im));
+        _mm512_storeu_ps(p + 16, _mm512_permutex2var_ps(re, high, im));
+    }
+
+    static V exponent(V x) { return _mm512_getexp_ps(x); }
+    static V mantissa(V x) { return _mm512_getmant_ps(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src); }
+};
+
+#include "SimdKernelsGeneric.h"
+
+} // namespace avx512
+FSHIFT_TARGET_END
+FSHIFT_AVX512_WARNINGS_END
+
+//==============================================================================
+namespace detail
+{
+
+FSHIFT_TARGET_BEGIN_SSE2
+const KernelTable* getSse2Kernels()
+{
+    static const KernelTable table = sse2::makeKernelTable(InstructionSet::SSE2);
+    return &table;
+}
+FSHIFT_TARGET_END
+
+FSHIFT_TARGET_BEGIN_AVX2
+const KernelTable* getAvx2Kernels()
+{
+    static const KernelTable table = avx2::makeKernelTable(InstructionSet::AVX2);
+    return &table;
+}
+FSHIFT_TARGET_END
+
+FSHIFT_TARGET_BEGIN_AVX512
+const KernelTable* getAvx512Kernels()
+{
+    static const KernelTable table = avx512::makeKernelTable(InstructionSet::AVX512);
+    return &table;
+}
+FSHIFT_TARGET_END
+
+} // namespace detail
+} // namespace simd
+} // namespace fshift
+
+#else
+
+namespace fshift
+{
+namespace simd
+{
+namespace detail
+{
+
+const KernelTable* getSse2Kernels() { return nullptr; }
+const KernelTable* getAvx2Kernels() { return nullptr; }
+const KernelTable* getAvx512Kernels() { return nullptr; }
+
+} // namespace detail
+} // namespace simd
+} // namespace fshift
+
+#endif
@@ -4,6 +4,8 @@
 #include <cmath>
 #include <algorithm>
 #include <complex>
+#include "RingBuffer.h"
+#include "DspArena.h"
 
 namespace fshift
 {
@@ -20,15 +22,73 @@ namespace fshift
  * - Frequency slope (low frequencies delayed more or less than high)
  * - Feedback with high-frequency damping
  * - Wet/dry mix
+ *
+ * The per-bin slope and damping curves live in an immutable Tables object
+ * that is built off the audio thread and shared by all instances; it is
+ * passed to process() so parameter changes never rebuild tables in place.
  */
 class SpectralDelay
 {
 public:
+    /**
+     * Per-bin curves derived from slope and damping.
+     * Built at a fixed resolution and sampled with a stride for smaller FFTs.
+     */
+    struct Tables
+    {
+        std::vector<float> slopeFactors;   // Delay multiplier per bin
+        std::vector<float> dampingCurve;   // Feedback gain per bin (HF absorption)
+    };
+
+    /** Largest slope multiplier buildTables produces (slope at +/-100%, at DC or Nyquist). */
+    static constexpr float MAX_SLOPE_FACTOR = 2.0f;
+
+    /**
+     * Build tables for a slope and damping setting.
+     * @param slope Frequency slope (-100% to +100%)
+     *              Negative: low frequencies delayed more
+     *              Positive: high frequencies delayed more
+     * @param damping High-frequency damping (0-100%)
+     * @param numBins Table resolution (a multiple of the bin count of every FFT in use)
+     */
+    static Tables buildTables(float slope, float damping, int numBins)
+    {
+        Tables tables;
+        tables.slopeFactors.resize(static_cast<size_t>(numBins));
+        tables.dampingCurve.resize(static_cast<size_t>(numBins));
+
+        slope = std::clamp(slope, -100.0f, 100.0f);
+        float dampAmount = std::clamp(damping, 0.0f, 100.0f) / 100.0f;
+
+        for (int bin = 0; bin < numBins; ++bin)
+        {
+            // Normalized bin position (0 = DC, 1 = Nyquist)
+            float binNorm = static_cast<float>(bin) / static_cast<float>(numBins);
+
+            // Apply slope: negative slope = more delay at low frequencies
+            // Map slope from -100..+100 to multiplier
+            float slopeFactor = 1.0f + (slope / 100.0f) * (binNorm - 0.5f) * 2.0f;
+            tables.slopeFactors[static_cast<size_t>(bin)] = std::max(0.1f, slopeFactor);  // Prevent negative/zero delay
+
+            // Exponential damping: more absorption at higher frequencies
+            // damping=0: no absorption, damping=100: strong HF absorption
+            float dampFactor = 1.0f - dampAmount * binNorm * binNorm;
+            tables.dampingCurve[static_cast<size_t>(bin)] = std::max(0.0f, dampFactor);
+        }
+
+        return tables;
+    }
+
     SpectralDelay() = default;
     ~SpectralDelay() = default;
 
     /**
      * Prepare the delay for processing.
+     *
+     * Only records the geometry: the per-bin lines are allocated by allocate(),
+     * so instances that never enable the delay don't pay for them. Lines that are
+     * already allocated for the same geometry are kept and cleared.
+     *
      * @param sampleRate Audio sample rate
      * @param fftSize FFT size
      * @param hopSize Hop size between frames
@@ -39,85 +99,119 @@ public:
         sampleRate = newSampleRate;
         fftSize = newFftSize;
         hopSize = newHopSize;
-        numBins = fftSize / 2;
 
         // Calculate max delay in frames
         double frameRate = sampleRate / static_cast<double>(hopSize);
         maxDelayFrames = static_cast<int>(std::ceil(maxDelayMs / 1000.0 * frameRate));
 
-        // Allocate delay buffers for each bin (magnitude and phase)
-        magnitudeBuffers.resize(static_cast<size_t>(numBins));
-        phaseBuffers.resize(static_cast<size_t>(numBins));
-
-        for (int bin = 0; bin < numBins; ++bin)
+        // Per-bin lines are rounded up to a power of two so wrapping is a mask
+        const int newNumBins = fftSize / 2;
+        const int newDelayMask = RingBuffer<float>::nextPowerOfTwo(maxDelayFrames) - 1;
+        if (newNumBins != numBins || newDelayMask != delayMask)
         {
-            magnitudeBuffers[static_cast<size_t>(bin)].resize(static_cast<size_t>(maxDelayFrames), 0.0f);
-            phaseBuffers[static_cast<size_t>(bin)].resize(static_cast<size_t>(maxDelayFrames), 0.0f);
+            numBins = newNumBins;
+            delayMask = newDelayMask;
+            magnitudeLines = {};
+            phaseLines = {};
+            writePositions = {};
         }
+        reset();
 
-        writePositions.resize(static_cast<size_t>(numBins), 0);
+        updateBaseDelayFrames();
+    }
 
-        // Pre-compute delay times and damping curve
-        computeDelayTimes();
-        computeDampingCurve();
+    /**
+     * Per-bin line storage for one geometry. Built off the audio thread with
+     * allocateLines() and handed to an instance with adoptLines().
+     */
+    struct Lines
+    {
+        std::vector<float> magnitude;
+        std::vector<float> phase;
+        std::vector<int> writePositions;
+    };
+
+    /**
+     * Allocate zeroed lines for a geometry (not real-time safe).
+     * @param numBins Bin count of the delay that will adopt them (getNumBins())
+     * @param delayMask Line length - 1 of that delay (getDelayMask())
+     */
+    static void allocateLines(Lines& lines, int numBins, int delayMask)
+    {
+        // One contiguous block per quantity: bin b's line starts at b * (delayMask + 1)
+        const size_t lineStorage = static_cast<size_t>(numBins) * static_cast<size_t>(delayMask + 1);
+        lines.magnitude.assign(lineStorage, 0.0f);
+        lines.phase.assign(lineStorage, 0.0f);
+        lines.writePositions.assign(static_cast<size_t>(numBins), 0);
     }
 
     /**
-     * Reset all delay buffers.
+     * Swap in lines built for the prepared geometry, without allocating or freeing.
+     * The previous (usually empty) storage is left in lines for the caller to free.
+     * @return false, leaving both untouched, if lines were built for another geometry
      */
-    void reset()
+    bool adoptLines(Lines& lines)
     {
-        for (int bin = 0; bin < numBins; ++bin)
-        {
-            std::fill(magnitudeBuffers[static_cast<size_t>(bin)].begin(),
-                      magnitudeBuffers[static_cast<size_t>(bin)].end(), 0.0f);
-            std::fill(phaseBuffers[static_cast<size_t>(bin)].begin(),
-                      phaseBuffers[static_cast<size_t>(bin)].end(), 0.0f);
-            writePositions[static_cast<size_t>(bin)] = 0;
-        }
+        const size_t lineStorage = static_cast<size_t>(numBins) * static_cast<size_t>(delayMask + 1);
+        if (numBins <= 0 || lines.writePositions.size() != static_cast<size_t>(numBins)
+            || lines.magnitude.size() != lineStorage || lines.phase.size() != lineStorage)
+            return false;
+
+        magnitudeLines.swap(lines.magnitude);
+        phaseLines.swap(lines.phase);
+        writePositions.swap(lines.writePositions);
+        return true;
     }
 
     /**
-     * Set base delay time in milliseconds.
+     * Allocate the per-bin lines for the prepared geometry (not real-time safe).
+     * Does nothing if they already exist.
      */
-    void setDelayTime(float ms)
+    void allocate()
     {
-        delayTimeMs = std::clamp(ms, 0.0f, 2000.0f);
-        computeDelayTimes();
+        if (isAllocated())
+            return;
+
+        Lines lines;
+        allocateLines(lines, numBins, delayMask);
+        adoptLines(lines);
     }
-    float getDelayTime() const { return delayTimeMs; }
+
+    /** Whether lines exist for the current geometry. */
+    bool isAllocated() const { return numBins > 0 && !writePositions.empty(); }
+
+    /** Geometry of the per-bin lines, as needed by allocateLines(). */
+    int getNumBins() const { return numBins; }
+    int getDelayMask() const { return delayMask; }
 
     /**
-     * Set frequency slope (-100% to +100%).
-     * Negative: low frequencies delayed more
-     * Positive: high frequencies delayed more
+     * Reset all delay buffers.
      */
-    void setFrequencySlope(float slope)
+    void reset()
     {
-        frequencySlope = std::clamp(slope, -100.0f, 100.0f);
-        computeDelayTimes();
+        std::fill(magnitudeLines.begin(), magnitudeLines.end(), 0.0f);
+        std::fill(phaseLines.begin(), phaseLines.end(), 0.0f);
+        std::fill(writePositions.begin(), writePositions.end(), 0);
     }
-    float getFrequencySlope() const { return frequencySlope; }
 
     /**
-     * Set feedback amount (0-95%).
+     * Set base delay time in milliseconds.
      */
-    void setFeedback(float fb)
+    void setDelayTime(float ms)
     {
-        feedback = std::clamp(fb, 0.0f, 0.95f);
+        delayTimeMs = std::clamp(ms, 0.0f, 2000.0f);
+        updateBaseDelayFrames();
     }
-    float getFeedback() const { return feedback; }
+    float getDelayTime() const { return delayTimeMs; }
 
     /**
-     * Set high-frequency damping (0-100%).
-     * Higher values = more HF absorption per repeat.
+     * Set feedback amount (0-95%).
      */
-    void setDamping(float damp)
+    void setFeedback(float fb)
     {
-        damping = std::clamp(damp, 0.0f, 100.0f);
-        computeDampingCurve();
+        feedback = std::clamp(fb, 0.0f, 0.95f);
     }
-    float getDamping() const { return damping; }
+    float getFeedback() const { return feedback; }
 
     /**
      * Set wet/dry mix for delay (0-100%).
@@ -138,33 +232,85 @@ public:
     }
     float getGainDb() const { return 20.0f * std::log10(gain); }
 
+    /**
+     * Copy parameters, write positions and the recent history from a delay of the
+     * same geometry, without allocating. Only the frames that a delay time of up to
+     * historyMs (stretched by MAX_SLOPE_FACTOR) can reach are copied.
+     */
+    void copyStateFrom(const SpectralDelay& other, float historyMs)
+    {
+        delayTimeMs = other.delayTimeMs;
+        baseDelayFrames = other.baseDelayFrames;
+        feedback = other.feedback;
+        mix = other.mix;
+        gain = other.gain;
+
+        if (!isAllocated() || !other.isAllocated() || numBins != other.numBins || delayMask != other.delayMask)
+            return;
+
+        const double frameRate = sampleRate / static_cast<double>(hopSize);
+        const int historyFrames = std::min(delayMask + 1,
+            static_cast<int>(std::ceil(historyMs / 1000.0 * frameRate * MAX_SLOPE_FACTOR)) + 1);
+        const size_t lineLength = static_cast<size_t>(delayMask + 1);
+
+        for (size_t bin = 0; bin < static_cast<size_t>(numBins); ++bin)
+        {
+            const int writePos = other.writePositions[bin];
+            writePositions[bin] = writePos;
+            for (int frame = 1; frame <= historyFrames; ++frame)
+            {
+                const size_t index = bin * lineLength + static_cast<size_t>((writePos - frame) & delayMask);
+                magnitudeLines[index] = other.magnitudeLines[index];
+                phaseLines[index] = other.phaseLines[index];
+            }
+        }
+    }
+
+    /** Heap bytes held by the per-bin delay lines (0 until allocate()). */
+    size_t getMemoryBytes() const
+    {
+        return getVectorBytes(magnitudeLines) + getVectorBytes(phaseLines) + getVectorBytes(writePositions);
+    }
+
     /**
      * Process spectrum through delay.
      * @param magnitude Input/output magnitude spectrum
      * @param phase Input/output phase spectrum
+     * @param tables Slope/damping curves (resolution >= numBins * decimation)
+     * @param decimation Ratio of the tables' sample rate to this delay's (a decimated band
+     *                   covers only the first 1/decimation of the tables)
      */
-    void process(std::vector<float>& magnitude, std::vector<float>& phase)
+    void process(std::vector<float>& magnitude, std::vector<float>& phase, const Tables& tables, int decimation = 1)
     {
-        // Early exit if not properly initialized or delay is too short
-        if (numBins <= 0 || delayFramesPerBin.empty() || dampingCurve.empty() || delayTimeMs < 0.1f)
+        const int span = numBins * std::max(1, decimation);
+
+        // Early exit if not allocated or delay is too short
+        if (!isAllocated() || static_cast<int>(tables.slopeFactors.size()) < span
+            || static_cast<int>(tables.dampingCurve.size()) < span || delayTimeMs < 0.1f)
             return;
 
+        // Tables are built at a common multiple of all FFT sizes; each samples every stride-th entry
+        const size_t stride = tables.slopeFactors.size() / static_cast<size_t>(span);
+
         // Process only the bins we have (min of magnitude size and our numBins)
         const int binsToProcess = std::min(static_cast<int>(magnitude.size()), numBins);
 
         for (int bin = 0; bin < binsToProcess; ++bin)
         {
             size_t binIdx = static_cast<size_t>(bin);
+            float* magnitudeLine = magnitudeLines.data() + binIdx * static_cast<size_t>(delayMask + 1);
+            float* phaseLine = phaseLines.data() + binIdx * static_cast<size_t>(delayMask + 1);
             int writePos = writePositions[binIdx];
-            int delayFrames = delayFramesPerBin[binIdx];
+            int delayFrames = static_cast<int>(baseDelayFrames * tables.slopeFactors[binIdx * stride]);
+            delayFrames = std::clamp(delayFrames, 1, maxDelayFrames - 1);
 
             // Read from delay line
-            int readPos = (writePos - delayFrames + maxDelayFrames) % maxDelayFrames;
-            float delayedMag = magnitudeBuffers[binIdx][static_cast<size_t>(readPos)];
-            float delayedPhase = phaseBuffers[binIdx][static_cast<size_t>(readPos)];
+            int readPos = (writePos - delayFrames) & delayMask;
+            float delayedMag = magnitudeLine[readPos];
+            float delayedPhase = phaseLine[readPos];
 
             // Get damping factor for this bin
-            float dampFactor = dampingCurve[binIdx];
+            float dampFactor = tables.dampingCurve[binIdx * stride];
 
             // Apply feedback with damping
             float feedbackMag = delayedMag * feedback * dampFactor;
@@ -174,8 +320,8 @@ public:
             float dryPhase = phase[binIdx];
 
             // Write to delay line (input + feedback)
-            magnitudeBuffers[binIdx][static_cast<size_t>(writePos)] = dryMag + feedbackMag;
-            phaseBuffers[binIdx][static_cast<size_t>(writePos)] = dryPhase;
+            magnitudeLine[writePos] = dryMag + feedbackMag;
+            phaseLine[writePos] = dryPhase;
 
             // Mix: crossfade between dry and wet (delayed) signal
             // At mix=0: 100% dry, 0% wet
@@ -190,7 +336,7 @@ public:
             }
 
             // Advance write position
-            writePositions[binIdx] = (writePos + 1) % maxDelayFrames;
+            writePositions[binIdx] = (writePos + 1) & delayMask;
         }
     }
 
@@ -198,72 +344,26 @@ private:
     double sampleRate = 44100.0;
     int fftSize = 4096;
     int hopSize = 1024;
-    int numBins = 2048;
+    int numBins = 0;
     int maxDelayFrames = 100;
+    int delayMask = 127;          // Per-bin line length - 1 (power of two)
 
     // Parameters
     float delayTimeMs = 200.0f;
-    float frequencySlope = 0.0f;   // -100 to +100
+    float baseDelayFrames = 0.0f;  // delayTimeMs in frames (slope applied per bin)
     float feedback = 0.3f;
-    float damping = 30.0f;         // 0-100%
     float mix = 0.5f;              // 0-1
     float gain = 1.0f;             // Linear gain for delayed signal
 
-    // Per-bin delay buffers
-    std::vector<std::vector<float>> magnitudeBuffers;
-    std::vector<std::vector<float>> phaseBuffers;
+    // Per-bin delay lines, stored back to back (numBins * (delayMask + 1))
+    std::vector<float> magnitudeLines;
+    std::vector<float> phaseLines;
     std::vector<int> writePositions;
 
-    // Pre-computed per-bin values
-    std::vector<int> delayFramesPerBin;
-    std::vector<float> dampingCurve;
-
-    /**
-     * Compute delay time for each bin based on slope.
-     */
-    void computeDelayTimes()
+    void updateBaseDelayFrames()
     {
-        delayFramesPerBin.resize(static_cast<size_t>(numBins));
-
         double frameRate = sampleRate / static_cast<double>(hopSize);
-        float baseDelayFrames = static_cast<float>(delayTimeMs / 1000.0 * frameRate);
-
-        for (int bin = 0; bin < numBins; ++bin)
-        {
-            // Normalized bin position (0 = DC, 1 = Nyquist)
-            float binNorm = static_cast<float>(bin) / static_cast<float>(numBins);
-
-            // Apply slope: negative slope = more delay at low frequencies
-            // Map slope from -100..+100 to multiplier
-            float slopeFactor = 1.0f + (frequencySlope / 100.0f) * (binNorm - 0.5f) * 2.0f;
-            slopeFactor = std::max(0.1f, slopeFactor);  // Prevent negative/zero delay
-
-            int delayFrames = static_cast<int>(baseDelayFrames * slopeFactor);
-            delayFrames = std::clamp(delayFrames, 1, maxDelayFrames - 1);
-
-            delayFramesPerBin[static_cast<size_t>(bin)] = delayFrames;
-        }
-    }
-
-    /**
-     * Compute damping curve (HF absorption).
-     */
-    void computeDampingCurve()
-    {
-        dampingCurve.resize(static_cast<size_t>(numBins));
-
-        for (int bin = 0; bin < numBins; ++bin)
-        {
-            float binNorm = static_cast<float>(bin) / static_cast<float>(numBins);
-
-            // Exponential damping: more absorption at higher frequencies
-            // damping=0: no absorption, damping=100: strong HF absorption
-            float dampAmount = damping / 100.0f;
-            float dampFactor = 1.0f - dampAmount * binNorm * binNorm;
-            dampFactor = std::max(0.0f, dampFactor);
-
-            dampingCurve[static_cast<size_t>(bin)] = dampFactor;
-        }
+        baseDelayFrames = static_cast<float>(delayTimeMs / 1000.0 * frameRate);
     }
 };
 
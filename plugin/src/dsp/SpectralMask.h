@@ -3,6 +3,7 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include "SimdKernels.h"
 
 namespace fshift
 {
@@ -89,7 +90,7 @@ public:
      */
     void computeMaskCurve(double sampleRate, int fftSize)
     {
-        int numBins = fftSize / 2;
+        int numBins = fftSize / 2 + 1;  // DC through Nyquist, matching STFT output
         float binResolution = static_cast<float>(sampleRate) / static_cast<float>(fftSize);
 
         maskCurve.resize(static_cast<size_t>(numBins));
@@ -121,15 +122,34 @@ public:
     void applyMask(std::vector<float>& wetMagnitude,
                    const std::vector<float>& dryMagnitude) const
     {
+        applyMask(maskCurve, wetMagnitude, dryMagnitude);
+    }
+
+    /**
+     * Apply a pre-computed mask curve to blend wet and dry spectra.
+     * The curve may have a finer bin resolution than the spectra (any integer
+     * multiple); bins are then sampled with the matching stride.
+     * @param curve Mask curve from computeMaskCurve
+     * @param wetMagnitude Processed magnitude spectrum (modified in place)
+     * @param dryMagnitude Original magnitude spectrum
+     * @param decimation Ratio of the curve's sample rate to the spectrum's (a decimated
+     *                   band covers only the first 1/decimation of the curve)
+     */
+    static void applyMask(const std::vector<float>& curve,
+                          std::vector<float>& wetMagnitude,
+                          const std::vector<float>& dryMagnitude,
+                          int decimation = 1)
+    {
+        if (curve.empty())
+            return;
+
+        const size_t stride = getCurveStride(curve, wetMagnitude.size(), decimation);
         size_t numBins = std::min(wetMagnitude.size(),
-                                   std::min(dryMagnitude.size(), maskCurve.size()));
+                                   std::min(dryMagnitude.size(), (curve.size() - 1) / stride + 1));
 
-        for (size_t bin = 0; bin < numBins; ++bin)
-        {
-            float mask = maskCurve[bin];
-            // Linear blend: output = wet * mask + dry * (1 - mask)
-            wetMagnitude[bin] = wetMagnitude[bin] * mask + dryMagnitude[bin] * (1.0f - mask);
-        }
+        // Linear blend: output = wet * mask + dry * (1 - mask)
+        simd::blend(wetMagnitude.data(), dryMagnitude.data(), curve.data(), static_cast<int>(stride),
+                    static_cast<int>(numBins));
     }
 
     /**
@@ -141,12 +161,31 @@ public:
     void applyMaskToPhase(std::vector<float>& wetPhase,
                           const std::vector<float>& dryPhase) const
     {
+        applyMaskToPhase(maskCurve, wetPhase, dryPhase);
+    }
+
+    /**
+     * Apply a pre-computed mask curve to blend wet and dry phase spectra.
+     * @param curve Mask curve from computeMaskCurve (same stride rules as applyMask)
+     * @param wetPhase Processed phase spectrum (modified in place)
+     * @param dryPhase Original phase spectrum
+     * @param decimation Ratio of the curve's sample rate to the spectrum's (see applyMask)
+     */
+    static void applyMaskToPhase(const std::vector<float>& curve,
+                                 std::vector<float>& wetPhase,
+                                 const std::vector<float>& dryPhase,
+                                 int decimation = 1)
+    {
+        if (curve.empty())
+            return;
+
+        const size_t stride = getCurveStride(curve, wetPhase.size(), decimation);
         size_t numBins = std::min(wetPhase.size(),
-                                   std::min(dryPhase.size(), maskCurve.size()));
+                                   std::min(dryPhase.size(), (curve.size() - 1) / stride + 1));
 
         for (size_t bin = 0; bin < numBins; ++bin)
         {
-            float mask = maskCurve[bin];
+            float mask = curve[bin * stride];
             if (mask < 0.999f)
             {
                 // For phase, we need to handle wraparound
@@ -174,6 +213,18 @@ private:
 
     std::vector<float> maskCurve;
 
+    /**
+     * Curve bins per spectrum bin (1 when the curve matches the spectrum size).
+     */
+    static size_t getCurveStride(const std::vector<float>& curve, size_t numBins, int decimation)
+    {
+        // Both include DC and Nyquist: (fftSize / 2 + 1) bins
+        const size_t span = (numBins - 1) * static_cast<size_t>(std::max(1, decimation));
+        if (numBins <= 1 || curve.size() <= span + 1)
+            return 1;
+        return (curve.size() - 1) / span;
+    }
+
     /**
      * Hermite smoothstep function for smooth transitions.
      */
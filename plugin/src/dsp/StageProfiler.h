@@ -0,0 +1,165 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Compile-time switch for per-stage CPU profiling (set by the FSHIFT_ENABLE_PROFILING
+// CMake option). When disabled, FSHIFT_PROFILE_SCOPE expands to nothing.
+#ifndef FSHIFT_PROFILING
+#define FSHIFT_PROFILING 0
+#endif
+
+namespace fshift
+{
+
+/**
+ * Processing stages measured by StageProfiler.
+ */
+enum class ProfileStage
+{
+    FrameExtract,
+    StftForward,
+    PhaseVocoder,
+    Shift,
+    Quantize,
+    Mask,
+    SpectralDelay,
+    StftInverse,
+    OverlapAdd,
+    ClassicHilbert,
+    Feedback,
+    NumStages
+};
+
+/**
+ * StageProfiler - Per-instance CPU time accumulator for each processing stage.
+ *
+ * The audio thread adds elapsed steady_clock nanoseconds with relaxed atomic
+ * increments (no locks, no allocation); the editor or an offline renderer
+ * reads a snapshot at any time. Counters are monotonic, so readers compute
+ * rates from the difference of two snapshots.
+ */
+class StageProfiler
+{
+public:
+    static constexpr int NUM_STAGES = static_cast<int>(ProfileStage::NumStages);
+
+    struct Snapshot
+    {
+        std::array<std::uint64_t, NUM_STAGES> nanos{};
+        std::array<std::uint64_t, NUM_STAGES> calls{};
+    };
+
+    /**
+     * RAII timer adding its lifetime to one stage.
+     */
+    class ScopedTimer
+    {
+    public:
+        ScopedTimer(StageProfiler& owner, ProfileStage timedStage)
+            : profiler(owner), stage(timedStage), start(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~ScopedTimer()
+        {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            profiler.add(stage, static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        StageProfiler& profiler;
+        ProfileStage stage;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    void add(ProfileStage stage, std::uint64_t nanos)
+    {
+        const auto index = static_cast<size_t>(stage);
+        stageNanos[index].fetch_add(nanos, std::memory_order_relaxed);
+        stageCalls[index].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Snapshot getSnapshot() const
+    {
+        Snapshot snapshot;
+        for (size_t i = 0; i < static_cast<size_t>(NUM_STAGES); ++i)
+        {
+            snapshot.nanos[i] = stageNanos[i].load(std::memory_order_relaxed);
+            snapshot.calls[i] = stageCalls[i].load(std::memory_order_relaxed);
+        }
+        return snapshot;
+    }
+
+    void reset()
+    {
+        for (size_t i = 0; i < static_cast<size_t>(NUM_STAGES); ++i)
+        {
+            stageNanos[i].store(0, std::memory_order_relaxed);
+            stageCalls[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    static const char* getStageName(ProfileStage stage)
+    {
+        switch (stage)
+        {
+            case ProfileStage::FrameExtract:   return "FrameExtract";
+            case ProfileStage::StftForward:    return "StftForward";
+            case ProfileStage::PhaseVocoder:   return "PhaseVocoder";
+            case ProfileStage::Shift:          return "Shift";
+            case ProfileStage::Quantize:       return "Quantize";
+            case ProfileStage::Mask:           return "Mask";
+            case ProfileStage::SpectralDelay:  return "SpectralDelay";
+            case ProfileStage::StftInverse:    return "StftInverse";
+            case ProfileStage::OverlapAdd:     return "OverlapAdd";
+            case ProfileStage::ClassicHilbert: return "ClassicHilbert";
+            case ProfileStage::Feedback:       return "Feedback";
+            case ProfileStage::NumStages:      break;
+        }
+        return "Unknown";
+    }
+
+    /**
+     * Format the current counters as CSV (stage,calls,total_ns,avg_ns).
+     * Not real-time safe (allocates); call from the message or render thread.
+     */
+    std::string toCsv() const
+    {
+        auto snapshot = getSnapshot();
+        std::string csv = "stage,calls,total_ns,avg_ns\n";
+        for (size_t i = 0; i < static_cast<size_t>(NUM_STAGES); ++i)
+        {
+            std::uint64_t calls = snapshot.calls[i];
+            csv += getStageName(static_cast<ProfileStage>(i));
+            csv += "," + std::to_string(calls);
+            csv += "," + std::to_string(snapshot.nanos[i]);
+            csv += "," + std::to_string(calls > 0 ? snapshot.nanos[i] / calls : 0);
+            csv += "\n";
+        }
+        return csv;
+    }
+
+private:
+    std::array<std::atomic<std::uint64_t>, NUM_STAGES> stageNanos{};
+    std::array<std::atomic<std::uint64_t>, NUM_STAGES> stageCalls{};
+};
+
+} // namespace fshift
+
+#define FSHIFT_PROFILE_CONCAT_INNER(a, b) a##b
+#define FSHIFT_PROFILE_CONCAT(a, b) FSHIFT_PROFILE_CONCAT_INNER(a, b)
+
+#if FSHIFT_PROFILING
+#define FSHIFT_PROFILE_SCOPE(profiler, stage) \
+    fshift::StageProfiler::ScopedTimer FSHIFT_PROFILE_CONCAT(fshiftProfileScope, __LINE__)((profiler), (stage))
+#else
+#define FSHIFT_PROFILE_SCOPE(profiler, stage) ((void) 0)
+#endif
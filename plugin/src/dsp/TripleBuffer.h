@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+namespace fshift
+{
+
+/**
+ * TripleBuffer - Wait-free single-producer / single-consumer snapshot exchange.
+ *
+ * The producer fills getWriteBuffer() and calls publish(); the consumer calls
+ * fetch() and, if it returns true, reads getReadBuffer(). Three slots rotate
+ * through one atomic index so neither side ever waits for the other, and the
+ * consumer always sees the most recently published complete value.
+ */
+template <typename T>
+class TripleBuffer
+{
+public:
+    /** Producer: slot to fill before publish(). */
+    T& getWriteBuffer() { return buffers[static_cast<size_t>(writeIndex)]; }
+
+    /** Producer: hand the write slot to the consumer and take the spare one. */
+    void publish()
+    {
+        const int previous = middle.exchange(writeIndex | FRESH_BIT, std::memory_order_acq_rel);
+        writeIndex = previous & INDEX_MASK;
+    }
+
+    /** Consumer: take the latest published slot. Returns false if nothing new. */
+    bool fetch()
+    {
+        if ((middle.load(std::memory_order_relaxed) & FRESH_BIT) == 0)
+            return false;
+
+        const int previous = middle.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    /** Consumer: slot obtained by the last successful fetch(). */
+    const T& getReadBuffer() const { return buffers[static_cast<size_t>(readIndex)]; }
+
+private:
+    static constexpr int INDEX_MASK = 0x3;
+    static constexpr int FRESH_BIT = 0x4;
+
+    std::array<T, 3> buffers{};
+    int writeIndex = 0;                  // Owned by the producer
+    int readIndex = 1;                   // Owned by the consumer
+    std::atomic<int> middle{ 2 };        // Spare slot, FRESH_BIT when unread
+};
+
+} // namespace fshift
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace fshift
+{
+
+/**
+ * VersionedTable - Immutable derived table published from a builder thread.
+ *
+ * The builder constructs a complete table and publish()es it; the audio thread
+ * calls acquire() once per block and uses the returned table until its next
+ * acquire(). Publication is a single atomic pointer store, so the audio thread
+ * never waits or allocates.
+ *
+ * Reclamation is deferred: acquire() records the version the reader now holds,
+ * and the builder frees only tables older than that version. A reader can only
+ * ever hold a table at least as new as the version it last recorded, so nothing
+ * it might still touch is freed.
+ */
+template <typename T>
+class VersionedTable
+{
+public:
+    /** Builder: publish a new table (never call from the audio thread). */
+    void publish(T table)
+    {
+        auto entry = std::make_unique<Entry>();
+        entry->value = std::move(table);
+
+        const std::lock_guard<std::mutex> lock(writerMutex);
+        entry->version = ++latestVersion;
+        current.store(entry.get(), std::memory_order_release);
+        entries.push_back(std::move(entry));
+        reclaim();
+    }
+
+    /** Audio thread: latest table (nullptr before the first publish). */
+    const T* acquire()
+    {
+        const Entry* entry = current.load(std::memory_order_acquire);
+        if (entry == nullptr)
+            return nullptr;
+
+        readerVersion.store(entry->version, std::memory_order_release);
+        return &entry->value;
+    }
+
+    /** Copy of the latest table for non-real-time readers such as the editor. */
+    T getLatestCopy() const
+    {
+        const std::lock_guard<std::mutex> lock(writerMutex);
+        return entries.empty() ? T{} : entries.back()->value;
+    }
+
+    /** Free all retired tables. Only call while the audio thread is not running. */
+    void reclaimAll()
+    {
+        const std::lock_guard<std::mutex> lock(writerMutex);
+        while (entries.size() > 1)
+            entries.pop_front();
+    }
+
+private:
+    struct Entry
+    {
+        std::uint64_t version = 0;
+        T value{};
+    };
+
+    // Called with writerMutex held. Entries are ordered by version.
+    void reclaim()
+    {
+        const std::uint64_t inUse = readerVersion.load(std::memory_order_acquire);
+        while (entries.size() > 1 && entries.front()->version < inUse)
+            entries.pop_front();
+    }
+
+    std::atomic<const Entry*> current{ nullptr };
+    std::atomic<std::uint64_t> readerVersion{ 0 };
+
+    mutable std::mutex writerMutex;
+    std::deque<std::unique_ptr<Entry>> entries;
+    std::uint64_t latestVersion = 0;
+};
+
+} // namespace fshift
@@ -0,0 +1,378 @@
+#include "TestHarness.h"
+#include "dsp/BandSplitter.h"
+#include "dsp/LatencyAlignment.h"
+#include "dsp/RingBuffer.h"
+#include "dsp/STFT.h"
+#include "dsp/SpectralDelay.h"
+#include "dsp/SpectralMask.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using fshift::BandSplitter;
+using fshift::RingBuffer;
+using fshift::SpectralDelay;
+using fshift::SpectralMask;
+using fshift::STFT;
+
+namespace
+{
+
+// Mirrors of the PluginProcessor geometry (the processor itself needs JUCE)
+constexpr int MAX_FFT_SIZE = 4096;
+constexpr int TABLE_FFT_SIZE = 3 * MAX_FFT_SIZE;
+constexpr int BAND_SPLIT_FACTOR = 4;
+constexpr int BAND_SPLIT_LOW_FFT_SIZE = MAX_FFT_SIZE / BAND_SPLIT_FACTOR;
+constexpr int BAND_SPLIT_LATENCY = BandSplitter::getLatencySamples(BAND_SPLIT_FACTOR);
+
+// Deterministic white noise in [-0.5, 0.5)
+std::vector<float> makeNoise(int length, uint32_t seed)
+{
+    std::vector<float> noise(static_cast<size_t>(length));
+    for (auto& sample : noise)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        sample = static_cast<float>(seed >> 8) / 16777216.0f - 0.5f;
+    }
+    return noise;
+}
+
+// Largest |output[n] - input[n - delay]| once both the delay and the warm-up have passed
+double maxDelayedError(const std::vector<float>& input, const std::vector<float>& output, int delay, int warmUp)
+{
+    double maxError = 0.0;
+    for (size_t n = static_cast<size_t>(delay + warmUp); n < output.size(); ++n)
+        maxError = std::max(maxError, std::abs(static_cast<double>(output[n]) - input[n - static_cast<size_t>(delay)]));
+    return maxError;
+}
+
+/**
+ * One STFT overlap-add path with no spectral processing, fed and read per sample
+ * in the same order as the processor (push, frame on hop, overlap-add at the
+ * head, pop and clear).
+ */
+struct OlaPath
+{
+    STFT stft;
+    RingBuffer<float> input;
+    RingBuffer<float> output;
+    int hopPhase = 0;
+
+    OlaPath(int fftSize, int hopSize, bool asymmetric)
+        : stft(fftSize, hopSize)
+    {
+        stft.prepare(48000.0);
+        stft.setAsymmetricWindows(asymmetric ? hopSize * 2 : 0);
+        input.setSize(fftSize * 2, fftSize);
+        output.setSize(fftSize * 2);
+    }
+
+    int getFrameLatency() const { return stft.getLatencySamples(); }
+
+    void push(float sample)
+    {
+        input.push(sample);
+        if (++hopPhase < stft.getHopSize())
+            return;
+
+        hopPhase = 0;
+        const int fftSize = stft.getFFTSize();
+        const auto [magnitude, phase] = stft.forward(input.getWindow(fftSize), fftSize);
+        const auto synthesized = stft.inverse(magnitude, phase);
+        const int offset = stft.getSynthesisOffset();
+        output.addFrom(0, synthesized.data() + offset, fftSize - offset);
+    }
+
+    float pop() { return output.popAndClear(); }
+};
+
+/**
+ * The BAND SPLIT chain as PluginProcessor::reinitializeDsp configures it: a full-rate
+ * high band path, a decimated BAND_SPLIT_LOW_FFT_SIZE low band path, and a crossover
+ * that delays whichever band finishes first.
+ */
+struct SplitChain
+{
+    OlaPath high;
+    OlaPath low;
+    BandSplitter splitter;
+    int frameLatency = 0;  // What the processor stores in currentFrameLatencies[0]
+
+    SplitChain(int highFftSize, int overlap, bool lowLatency)
+        : high(highFftSize, highFftSize / overlap, lowLatency && overlap > 2),
+          low(BAND_SPLIT_LOW_FFT_SIZE, BAND_SPLIT_LOW_FFT_SIZE / overlap, lowLatency && overlap > 2)
+    {
+        const int highBandDelay = fshift::latency::getOlaPathDelay(high.getFrameLatency());
+        const int lowBandDelay = fshift::latency::getOlaPathDelay(low.getFrameLatency()) * BAND_SPLIT_FACTOR;
+        splitter.prepare(BAND_SPLIT_FACTOR, std::max(0, lowBandDelay - highBandDelay),
+                         std::max(0, highBandDelay - lowBandDelay));
+        frameLatency = BAND_SPLIT_LATENCY + std::max(highBandDelay, lowBandDelay) + 1;
+    }
+
+    float process(float sample)
+    {
+        float highSample = 0.0f;
+        float lowSample = 0.0f;
+        const bool hasLow = splitter.split(sample, highSample, lowSample);
+        if (hasLow)
+            low.push(lowSample);
+        high.push(highSample);
+
+        if (hasLow)
+            splitter.pushLow(low.pop());
+        return splitter.combine(high.pop());
+    }
+};
+
+/**
+ * The Spectral output stage: delay compensation pads the wet path up to the reported
+ * latency, and the dry line (used for the mix and the TRUE BYPASS crossfade) is read
+ * at the reported latency.
+ */
+struct OutputStage
+{
+    RingBuffer<float> delayComp;
+    RingBuffer<float> dry;
+    int reportedLatency = 0;
+    int delayNeeded = 0;
+
+    OutputStage(int reportedLatency, int frameLatency)
+        : reportedLatency(reportedLatency),
+          delayNeeded(fshift::latency::getCompensationDelay(reportedLatency, frameLatency))
+    {
+        delayComp.setSize(MAX_FFT_SIZE * 2);
+        dry.setSize(MAX_FFT_SIZE + BAND_SPLIT_LATENCY + 1);
+    }
+
+    float processWet(float spectralSample)
+    {
+        delayComp.push(spectralSample);
+        return delayComp.getDelayed(fshift::latency::getTapAfterPush(delayNeeded));
+    }
+
+    float processDry(float drySample)
+    {
+        dry.push(drySample);
+        return dry.getDelayed(fshift::latency::getTapAfterPush(reportedLatency));
+    }
+};
+
+// Wet and dry taps of one geometry against the input delayed by the reported latency
+template <typename Path>
+void checkOutputAlignment(Path& path, int frameLatency, int reportedLatency, uint32_t seed)
+{
+    OutputStage stage(reportedLatency, frameLatency);
+    CHECK(stage.delayNeeded >= 1);
+
+    const auto input = makeNoise(6 * MAX_FFT_SIZE, seed);
+    std::vector<float> wet(input.size());
+    std::vector<float> dry(input.size());
+    for (size_t n = 0; n < input.size(); ++n)
+    {
+        wet[n] = stage.processWet(path.process(input[n]));
+        dry[n] = stage.processDry(input[n]);
+    }
+
+    // The dry tap is exact, and an unprocessed wet path matches it, so the bypass
+    // crossfade and the dry/wet mix blend aligned signals instead of combing
+    CHECK_NEAR(maxDelayedError(input, dry, reportedLatency, 0), 0.0, 0.0);
+    CHECK_NEAR(maxDelayedError(input, wet, reportedLatency, MAX_FFT_SIZE), 0.0, 2.0e-5);
+    CHECK(maxDelayedError(input, wet, reportedLatency - 1, MAX_FFT_SIZE) > 0.1);
+}
+
+// OlaPath with the SplitChain interface
+struct PlainChain
+{
+    OlaPath path;
+    PlainChain(int fftSize, int overlap, bool lowLatency)
+        : path(fftSize, fftSize / overlap, lowLatency && overlap > 2) {}
+
+    float process(float sample)
+    {
+        path.push(sample);
+        return path.pop();
+    }
+};
+
+} // namespace
+
+// Unprocessed high + low reconstructs the input, delayed by getLatencySamples()
+FSHIFT_TEST(bandSplitterReconstructsInput)
+{
+    BandSplitter splitter;
+    splitter.prepare(BAND_SPLIT_FACTOR, 0, 0);
+    CHECK(BandSplitter::getLatencySamples(BAND_SPLIT_FACTOR) == 96);
+
+    const auto input = makeNoise(8192, 17u);
+    std::vector<float> output(input.size());
+    for (size_t n = 0; n < input.size(); ++n)
+    {
+        float high = 0.0f;
+        float low = 0.0f;
+        if (splitter.split(input[n], high, low))
+            splitter.pushLow(low);
+        output[n] = splitter.combine(high);
+    }
+
+    CHECK_NEAR(maxDelayedError(input, output, BAND_SPLIT_LATENCY, 0), 0.0, 1.0e-6);
+
+    // One sample either way is far off on noise, so the latency is exact
+    CHECK(maxDelayedError(input, output, BAND_SPLIT_LATENCY + 1, 0) > 0.1);
+    CHECK(maxDelayedError(input, output, BAND_SPLIT_LATENCY - 1, 0) > 0.1);
+}
+
+// The processor's OLA convention: a path delays by its frame latency minus one sample
+FSHIFT_TEST(olaPathDelaysByFrameLatencyMinusOne)
+{
+    for (bool asymmetric : { false, true })
+    {
+        OlaPath path(1024, 256, asymmetric);
+        const auto input = makeNoise(8192, 5u);
+        std::vector<float> output(input.size());
+        for (size_t n = 0; n < input.size(); ++n)
+        {
+            path.push(input[n]);
+            output[n] = path.pop();
+        }
+
+        const int delay = path.getFrameLatency() - 1;
+        CHECK_NEAR(maxDelayedError(input, output, delay, 1024), 0.0, 1.0e-5);
+        CHECK(maxDelayedError(input, output, delay + 1, 1024) > 0.1);
+    }
+}
+
+// With BAND SPLIT, currentFrameLatencies[0] describes the whole split chain the same
+// way, so delay compensation up to getSpectralLatencySamples() lines wet up with dry
+FSHIFT_TEST(splitChainMatchesReportedFrameLatency)
+{
+    for (int highFftSize : { 256, 768, 1024, 3072, 4096 })
+    {
+        for (int overlap : { 2, 4, 8 })
+        {
+            for (bool lowLatency : { false, true })
+            {
+                SplitChain chain(highFftSize, overlap, lowLatency);
+
+                const auto input = makeNoise(6 * MAX_FFT_SIZE, static_cast<uint32_t>(highFftSize * overlap));
+                std::vector<float> output(input.size());
+                for (size_t n = 0; n < input.size(); ++n)
+                    output[n] = chain.process(input[n]);
+
+                const int delay = chain.frameLatency - 1;
+                CHECK_NEAR(maxDelayedError(input, output, delay, MAX_FFT_SIZE), 0.0, 2.0e-5);
+                CHECK(maxDelayedError(input, output, delay + 1, MAX_FFT_SIZE) > 0.1);
+
+                // Without LOW LATENCY the reported MAX_FFT_SIZE + BAND_SPLIT_LATENCY covers the chain
+                if (!lowLatency)
+                    CHECK(chain.frameLatency <= MAX_FFT_SIZE + BAND_SPLIT_LATENCY);
+            }
+        }
+    }
+}
+
+// Processed identity lines up with the bypass dry tap at the reported latency, for every
+// geometry the reported latency is derived from (getSpectralLatencySamples)
+FSHIFT_TEST(wetPathMatchesBypassDryTap)
+{
+    for (int fftSize : { 256, 1024, 3072, 4096 })
+    {
+        for (int overlap : { 2, 4, 8 })
+        {
+            for (bool lowLatency : { false, true })
+            {
+                const auto seed = static_cast<uint32_t>(fftSize * overlap + (lowLatency ? 1 : 0));
+
+                PlainChain plain(fftSize, overlap, lowLatency);
+                const int plainLatency = plain.path.getFrameLatency();
+                checkOutputAlignment(plain, plainLatency, lowLatency ? plainLatency : MAX_FFT_SIZE, seed);
+
+                SplitChain split(fftSize, overlap, lowLatency);
+                checkOutputAlignment(split, split.frameLatency,
+                                     lowLatency ? split.frameLatency : MAX_FFT_SIZE + BAND_SPLIT_LATENCY, seed);
+            }
+        }
+    }
+}
+
+// The mask curve is built at TABLE_FFT_SIZE; a decimated low band reads its first quarter
+FSHIFT_TEST(maskCurveStrideFollowsDecimation)
+{
+    // Curve entry i holds i / 6144, so each output bin reveals the entry it read
+    const size_t curveSize = TABLE_FFT_SIZE / 2 + 1;
+    std::vector<float> curve(curveSize);
+    for (size_t i = 0; i < curveSize; ++i)
+        curve[i] = static_cast<float>(i) / static_cast<float>(curveSize - 1);
+
+    auto readEntries = [&curve](int fftSize, int decimation)
+    {
+        const size_t numBins = static_cast<size_t>(fftSize / 2 + 1);
+        std::vector<float> wet(numBins, 1.0f);
+        const std::vector<float> dry(numBins, 0.0f);
+        SpectralMask::applyMask(curve, wet, dry, decimation);
+
+        std::vector<int> entries(numBins);
+        for (size_t bin = 0; bin < numBins; ++bin)
+            entries[bin] = static_cast<int>(std::lround(wet[bin] * static_cast<float>(curve.size() - 1)));
+        return entries;
+    };
+
+    // 1024-point low band at a quarter of the rate: bin b is entry 3b, up to a quarter of the curve
+    const auto lowBand = readEntries(BAND_SPLIT_LOW_FFT_SIZE, BAND_SPLIT_FACTOR);
+    for (size_t bin = 0; bin < lowBand.size(); ++bin)
+        CHECK(lowBand[bin] == static_cast<int>(3 * bin));
+
+    // Full-rate sizes: 4096 reads every third entry, 1024 every twelfth, 768 every sixteenth
+    const auto full4096 = readEntries(4096, 1);
+    const auto full1024 = readEntries(1024, 1);
+    const auto full768 = readEntries(768, 1);
+    CHECK(full4096[1] == 3 && full4096.back() == TABLE_FFT_SIZE / 2);
+    CHECK(full1024[1] == 12 && full1024.back() == TABLE_FFT_SIZE / 2);
+    CHECK(full768[1] == 16 && full768.back() == TABLE_FFT_SIZE / 2);
+}
+
+// Spectral delay tables have TABLE_FFT_SIZE / 2 entries; the low band samples them with stride 3
+FSHIFT_TEST(spectralDelayStrideFollowsDecimation)
+{
+    // Entries 0, 3, 6, ... alternate between one and two times the delay time; every other
+    // entry is the minimum factor, so a wrong stride shows up as a one-frame delay.
+    // Stride 12 (the low band read as if it were full rate) would give every bin factor 1.
+    const int tableBins = TABLE_FFT_SIZE / 2;
+    SpectralDelay::Tables tables;
+    tables.slopeFactors.assign(static_cast<size_t>(tableBins), 0.1f);
+    tables.dampingCurve.assign(static_cast<size_t>(tableBins), 1.0f);
+    for (int i = 0; i < tableBins; i += 3)
+        tables.slopeFactors[static_cast<size_t>(i)] = (i / 3) % 2 == 0 ? 1.0f : 2.0f;
+
+    // 12.8 kHz low band with a 256-sample hop: 50 frames per second, so 200 ms is 10 frames
+    const int hopSize = BAND_SPLIT_LOW_FFT_SIZE / 4;
+    SpectralDelay delay;
+    delay.prepare(51200.0 / BAND_SPLIT_FACTOR, BAND_SPLIT_LOW_FFT_SIZE, hopSize);
+    delay.allocate();
+    delay.setDelayTime(200.0f);
+    delay.setFeedback(0.0f);
+    delay.setMix(100.0f);
+    delay.setGain(0.0f);
+
+    // An impulse in every bin, then silence; record the frame each bin's impulse comes back in
+    const size_t numBins = static_cast<size_t>(BAND_SPLIT_LOW_FFT_SIZE / 2 + 1);
+    std::vector<int> arrival(numBins, -1);
+    for (int frame = 0; frame < 30; ++frame)
+    {
+        std::vector<float> magnitude(numBins, frame == 0 ? 1.0f : 0.0f);
+        std::vector<float> phase(numBins, 0.0f);
+        delay.process(magnitude, phase, tables, BAND_SPLIT_FACTOR);
+        for (size_t bin = 0; bin < numBins; ++bin)
+        {
+            if (arrival[bin] < 0 && magnitude[bin] > 0.5f)
+                arrival[bin] = frame;
+        }
+    }
+
+    // The delay owns numBins = fftSize / 2 lines; the Nyquist bin passes through
+    for (size_t bin = 0; bin + 1 < numBins; ++bin)
+        CHECK(arrival[bin] == (bin % 2 == 0 ? 10 : 20));
+}
+
+FSHIFT_TEST_MAIN()
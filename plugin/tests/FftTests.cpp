@@ -0,0 +1,163 @@
+#include "TestHarness.h"
+#include "dsp/FixedSizeFFT.h"
+#include "dsp/MixedRadixFFT.h"
+#include "dsp/STFT.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+using fshift::MixedRadixFFT;
+using fshift::STFT;
+
+namespace
+{
+
+// Deterministic white noise in [-1, 1)
+std::vector<float> makeNoise(int length, uint32_t seed)
+{
+    std::vector<float> noise(static_cast<size_t>(length));
+    for (auto& sample : noise)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        sample = static_cast<float>(seed >> 8) / 8388608.0f - 1.0f;
+    }
+    return noise;
+}
+
+std::vector<std::complex<float>> makeComplexNoise(int length, uint32_t seed)
+{
+    const auto re = makeNoise(length, seed);
+    const auto im = makeNoise(length, seed ^ 0x9e3779b9u);
+    std::vector<std::complex<float>> data(static_cast<size_t>(length));
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = { re[i], im[i] };
+    return data;
+}
+
+// Reference forward DFT (e^{-i...}) in double precision
+std::vector<std::complex<double>> referenceDft(const std::vector<std::complex<float>>& input)
+{
+    const size_t n = input.size();
+    std::vector<std::complex<double>> output(n);
+    for (size_t k = 0; k < n; ++k)
+    {
+        std::complex<double> sum = 0.0;
+        for (size_t t = 0; t < n; ++t)
+        {
+            // Reduce k * t first so the angle stays exact for large sizes
+            const double angle = -2.0 * std::numbers::pi * static_cast<double>((k * t) % n) / static_cast<double>(n);
+            sum += std::complex<double>(input[t]) * std::polar(1.0, angle);
+        }
+        output[k] = sum;
+    }
+    return output;
+}
+
+// RMS error of a float transform relative to the RMS of the reference spectrum
+double relativeRmsError(const std::vector<std::complex<float>>& actual, const std::vector<std::complex<double>>& expected)
+{
+    double errorEnergy = 0.0;
+    double signalEnergy = 0.0;
+    for (size_t k = 0; k < expected.size(); ++k)
+    {
+        errorEnergy += std::norm(std::complex<double>(actual[k]) - expected[k]);
+        signalEnergy += std::norm(expected[k]);
+    }
+    return std::sqrt(errorEnergy / signalEnergy);
+}
+
+// Relative RMS error against the exact DFT: about one float epsilon for these sizes
+constexpr double DFT_TOLERANCE = 2.0e-7;
+
+// Largest sample error after overlap-add: a few float epsilons at full scale
+constexpr double ROUND_TRIP_TOLERANCE = 4.8e-7;
+
+template <int N>
+void checkFixedSize()
+{
+    auto data = makeComplexNoise(N, static_cast<uint32_t>(N));
+    const auto expected = referenceDft(data);
+    fshift::FixedSizeFFT<N>::forward(data.data());
+    const double error = relativeRmsError(data, expected);
+    CHECK_NEAR(error, 0.0, DFT_TOLERANCE);
+}
+
+} // namespace
+
+// Every specialized power-of-two kernel against the double-precision DFT
+FSHIFT_TEST(fixedSizeMatchesReferenceDft)
+{
+    checkFixedSize<4>();
+    checkFixedSize<8>();
+    checkFixedSize<128>();
+    checkFixedSize<256>();
+    checkFixedSize<512>();
+    checkFixedSize<1024>();
+    checkFixedSize<2048>();
+    checkFixedSize<4096>();
+
+    // The runtime lookup hands out the same kernels, and nothing for other sizes
+    CHECK(fshift::getFixedSizeFFT(1024) == &fshift::FixedSizeFFT<1024>::forward);
+    CHECK(fshift::getFixedSizeFFT(384) == nullptr);
+}
+
+// Split sizes (3 or 5 times a specialized kernel) and generic Stockham sizes
+FSHIFT_TEST(mixedRadixMatchesReferenceDft)
+{
+    for (int size : { 384, 768, 1536, 3072, 640, 2, 3, 5, 12, 60, 360, 1000, 1200, 2250 })
+    {
+        CHECK(MixedRadixFFT::isSupportedSize(size));
+        const MixedRadixFFT plan(size);
+        CHECK(plan.getSize() == size);
+
+        auto data = makeComplexNoise(size, static_cast<uint32_t>(size) * 7919u);
+        const auto expected = referenceDft(data);
+        std::vector<std::complex<float>> scratch(static_cast<size_t>(size));
+        plan.forward(data.data(), scratch.data());
+        const double error = relativeRmsError(data, expected);
+        CHECK_NEAR(error, 0.0, DFT_TOLERANCE);
+    }
+
+    CHECK(!MixedRadixFFT::isSupportedSize(0));
+    CHECK(!MixedRadixFFT::isSupportedSize(7));
+    CHECK(!MixedRadixFFT::isSupportedSize(3 * 1024 * 11));
+}
+
+// forward -> inverse -> overlap-add reconstructs the input once frames fully overlap
+FSHIFT_TEST(stftOverlapAddRoundTrip)
+{
+    for (int fftSize : { 384, 768, 1536, 3072 })
+    {
+        for (int overlap : { 2, 4, 8 })
+        {
+            const int hopSize = fftSize / overlap;
+            STFT stft(fftSize, hopSize);
+            stft.prepare(48000.0);
+
+            const int length = fftSize * 6;
+            const auto input = makeNoise(length, static_cast<uint32_t>(fftSize + overlap));
+            std::vector<double> output(static_cast<size_t>(length), 0.0);
+
+            for (int start = 0; start + fftSize <= length; start += hopSize)
+            {
+                // Frames are read in place, as the processor reads its input rings
+                const auto [magnitude, phase] = stft.forward(input.data() + start, fftSize);
+                const auto synthesized = stft.inverse(magnitude, phase);
+                for (int i = 0; i < fftSize; ++i)
+                    output[static_cast<size_t>(start + i)] += synthesized[static_cast<size_t>(i)];
+            }
+
+            // Skip the ramp-up and ramp-down, where fewer than `overlap` frames contribute
+            double maxError = 0.0;
+            for (int i = fftSize; i < length - fftSize; ++i)
+                maxError = std::max(maxError, std::abs(output[static_cast<size_t>(i)] - input[static_cast<size_t>(i)]));
+            CHECK_NEAR(maxError, 0.0, ROUND_TRIP_TOLERANCE);
+        }
+    }
+}
+
+FSHIFT_TEST_MAIN()
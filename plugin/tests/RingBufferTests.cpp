@@ -0,0 +1,167 @@
+#include "TestHarness.h"
+#include "dsp/RingBuffer.h"
+#include "dsp/VersionedTable.h"
+
+#include <memory>
+#include <vector>
+
+using fshift::RingBuffer;
+using fshift::VersionedTable;
+
+// getDelayed, write and addFrom across the wrap point of an 8-slot ring
+FSHIFT_TEST(readsAcrossWrapPoint)
+{
+    RingBuffer<float> ring;
+    ring.setSize(8);
+    CHECK(ring.getCapacity() == 8);
+
+    // 13 pushes leave the head at 5, so the newest 8 samples straddle the wrap
+    for (int i = 0; i < 13; ++i)
+        ring.push(static_cast<float>(i));
+    CHECK(ring.getHead() == 5);
+    for (int delay = 1; delay <= 8; ++delay)
+        CHECK(ring.getDelayed(delay) == static_cast<float>(13 - delay));
+
+    // A block write that wraps: 6 samples from head 5 land in slots 5..7 and 0..2
+    const std::vector<float> block = { 100.0f, 101.0f, 102.0f, 103.0f, 104.0f, 105.0f };
+    ring.write(block.data(), static_cast<int>(block.size()));
+    CHECK(ring.getHead() == 3);
+    for (int delay = 1; delay <= 6; ++delay)
+        CHECK(ring.getDelayed(delay) == block[block.size() - static_cast<size_t>(delay)]);
+    CHECK(ring.getDelayed(7) == 12.0f);
+
+    // A write longer than the ring keeps only the newest capacity samples
+    std::vector<float> longBlock(20);
+    for (size_t i = 0; i < longBlock.size(); ++i)
+        longBlock[i] = 200.0f + static_cast<float>(i);
+    ring.write(longBlock.data(), static_cast<int>(longBlock.size()));
+    for (int delay = 1; delay <= 8; ++delay)
+        CHECK(ring.getDelayed(delay) == longBlock[longBlock.size() - static_cast<size_t>(delay)]);
+
+    // Overlap-add across the wrap, then read it back at the head
+    ring.reset();
+    for (int i = 0; i < 6; ++i)
+        ring.push(0.0f);
+    const std::vector<float> frame = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+    ring.addFrom(0, frame.data(), static_cast<int>(frame.size()));
+    ring.addFrom(1, frame.data(), static_cast<int>(frame.size()));
+    const std::vector<float> expected = { 1.0f, 3.0f, 5.0f, 7.0f, 9.0f, 5.0f, 0.0f };
+    for (float value : expected)
+        CHECK(ring.popAndClear() == value);
+}
+
+// With the mirror as long as the ring, every window up to capacity is contiguous
+FSHIFT_TEST(mirroredWindowAtCapacity)
+{
+    constexpr int capacity = 16;
+    RingBuffer<float> ring;
+    ring.setSize(capacity, capacity);
+
+    float next = 0.0f;
+    for (int step = 0; step < 3 * capacity; ++step)
+    {
+        // Alternate single pushes and block writes so both keep the mirror in sync
+        if (step % 2 == 0)
+        {
+            ring.push(next++);
+        }
+        else
+        {
+            const float block[3] = { next, next + 1.0f, next + 2.0f };
+            ring.write(block, 3);
+            next += 3.0f;
+        }
+
+        if (next < static_cast<float>(capacity))
+            continue;
+
+        for (int length : { 1, capacity / 2, capacity - 1, capacity })
+        {
+            const float* window = ring.getWindow(length);
+            for (int i = 0; i < length; ++i)
+                CHECK(window[i] == next - static_cast<float>(length - i));
+        }
+    }
+
+    // popAndClear must clear the mirrored copy too
+    RingBuffer<float> output;
+    output.setSize(capacity, capacity);
+    for (int i = 0; i < capacity; ++i)
+        output.push(1.0f);
+    for (int i = 0; i < capacity; ++i)
+        output.popAndClear();
+    const float* window = output.getWindow(capacity);
+    for (int i = 0; i < capacity; ++i)
+        CHECK(window[i] == 0.0f);
+}
+
+// copyRecentFrom carries the head, the requested history and its mirror
+FSHIFT_TEST(copyRecentKeepsLiveHistory)
+{
+    RingBuffer<float> source;
+    RingBuffer<float> target;
+    source.setSize(64, 16);
+    target.setSize(64, 16);
+
+    for (int i = 0; i < 200; ++i)
+        source.push(static_cast<float>(i));
+    for (int i = 0; i < 37; ++i)
+        target.push(-1.0f);
+
+    target.copyRecentFrom(source, 16);
+    CHECK(target.getHead() == source.getHead());
+    for (int delay = 1; delay <= 16; ++delay)
+        CHECK(target.getDelayed(delay) == source.getDelayed(delay));
+
+    const float* sourceWindow = source.getWindow(16);
+    const float* targetWindow = target.getWindow(16);
+    for (int i = 0; i < 16; ++i)
+        CHECK(targetWindow[i] == sourceWindow[i]);
+}
+
+// A table is only freed once the reader has moved on to a newer version
+FSHIFT_TEST(versionedTableRetiresAfterRelease)
+{
+    using Table = std::shared_ptr<int>;
+    VersionedTable<Table> tables;
+    CHECK(tables.acquire() == nullptr);
+
+    // weak_ptrs observe when the table holding each value is destroyed
+    auto first = std::make_shared<int>(1);
+    std::weak_ptr<int> firstAlive = first;
+    tables.publish(std::move(first));
+
+    const Table* held = tables.acquire();
+    CHECK(held != nullptr && **held == 1);
+
+    auto second = std::make_shared<int>(2);
+    std::weak_ptr<int> secondAlive = second;
+    tables.publish(std::move(second));
+
+    auto third = std::make_shared<int>(3);
+    std::weak_ptr<int> thirdAlive = third;
+    tables.publish(std::move(third));
+
+    // The reader still holds version 1: nothing it may touch is freed
+    CHECK(!firstAlive.expired());
+    CHECK(**held == 1);
+
+    // Acquiring releases version 1; the next publish retires everything older than 3
+    held = tables.acquire();
+    CHECK(held != nullptr && **held == 3);
+    CHECK(!firstAlive.expired());
+
+    tables.publish(std::make_shared<int>(4));
+    CHECK(firstAlive.expired());
+    CHECK(secondAlive.expired());
+    CHECK(!thirdAlive.expired());
+    CHECK(**held == 3);
+
+    // With the audio thread stopped, everything but the latest table can go
+    tables.acquire();
+    tables.reclaimAll();
+    CHECK(thirdAlive.expired());
+    CHECK(*tables.getLatestCopy() == 4);
+}
+
+FSHIFT_TEST_MAIN()
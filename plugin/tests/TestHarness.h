@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+/**
+ * Minimal test harness for the DSP unit tests (no external framework).
+ *
+ * FSHIFT_TEST(name) registers a test; CHECK / CHECK_NEAR record failures and keep
+ * going, so one run reports every broken expectation. Each test file ends with
+ * FSHIFT_TEST_MAIN(), and the executable's exit code tells CTest the result.
+ */
+namespace fshift::test
+{
+
+struct TestCase
+{
+    const char* name;
+    void (*run)();
+};
+
+inline std::vector<TestCase>& getRegistry()
+{
+    static std::vector<TestCase> tests;
+    return tests;
+}
+
+inline int& getFailureCount()
+{
+    static int failures = 0;
+    return failures;
+}
+
+struct Registrar
+{
+    Registrar(const char* name, void (*run)()) { getRegistry().push_back({ name, run }); }
+};
+
+inline void checkTrue(bool condition, const char* expression, const char* file, int line)
+{
+    if (condition)
+        return;
+    std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", file, line, expression);
+    ++getFailureCount();
+}
+
+inline void checkNear(double actual, double expected, double tolerance,
+                      const char* expression, const char* file, int line)
+{
+    if (std::abs(actual - expected) <= tolerance)
+        return;
+    std::fprintf(stderr, "%s:%d: CHECK_NEAR failed: %s = %g, expected %g +/- %g\n",
+                 file, line, expression, actual, expected, tolerance);
+    ++getFailureCount();
+}
+
+inline int runAll()
+{
+    int failedTests = 0;
+    for (const auto& test : getRegistry())
+    {
+        const int failuresBefore = getFailureCount();
+        test.run();
+        const bool passed = getFailureCount() == failuresBefore;
+        std::printf("[%s] %s\n", passed ? "  OK  " : " FAIL ", test.name);
+        failedTests += passed ? 0 : 1;
+    }
+    std::printf("%zu tests, %d failed\n", getRegistry().size(), failedTests);
+    return failedTests == 0 ? 0 : 1;
+}
+
+} // namespace fshift::test
+
+#define FSHIFT_TEST(name)                                               \
+    static void name();                                                 \
+    static const fshift::test::Registrar name##Registrar(#name, name); \
+    static void name()
+
+#define FSHIFT_TEST_MAIN() \
+    int main() { return fshift::test::runAll(); }
+
+#define CHECK(condition) \
+    fshift::test::checkTrue(static_cast<bool>(condition), #condition, __FILE__, __LINE__)
+
+#define CHECK_NEAR(actual, expected, tolerance)                                             \
+    fshift::test::checkNear(static_cast<double>(actual), static_cast<double>(expected),     \
+                            static_cast<double>(tolerance), #actual, __FILE__, __LINE__)